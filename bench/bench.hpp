@@ -0,0 +1,43 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+
+namespace ve
+{
+	namespace bench
+	{
+		// Calls function repeats times and returns the time of the fastest call in seconds.
+		template <typename Function>
+		double measure(Function const & function, unsigned int repeats = 5)
+		{
+			double best = 0;
+			for (unsigned int i = 0; i < repeats; i++)
+			{
+				auto start = std::chrono::high_resolution_clock::now();
+				function();
+				double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+				if (i == 0 || seconds < best)
+				{
+					best = seconds;
+				}
+			}
+			return best;
+		}
+
+		// Prints the name, the total time, and the time per item for count items done in seconds.
+		inline void report(char const * name, unsigned int count, double seconds)
+		{
+			std::printf("%-40s %10u items %10.3f ms %10.2f ns/item\n", name, count, seconds * 1.0e3, seconds * 1.0e9 / count);
+		}
+
+		// Keeps the compiler from optimizing away the work that made value.
+		template <typename T>
+		void keep(T const & value)
+		{
+			static T volatile sink;
+			sink = value;
+			(void)sink;
+		}
+	}
+}
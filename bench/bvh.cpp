@@ -0,0 +1,184 @@
+// Times the Bvh at 10k, 100k and 1M objects: inserting them, box, sphere and frustum queries, a full scan of every box for comparison,
+// and frames where every object moves, which exercise the refits, the reinserts and the rebuilds done by checkCost.
+// The objects are spread so that each query finds about the same number of them at every size.
+
+#include "bench.hpp"
+#include "util/bvh.hpp"
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ve;
+
+// Returns a frustum with a 90 degree field of view from the position, looking down the -z axis, out to a distance of far.
+Frustum getFrustum(Vector3f position, float far)
+{
+	float near = 0.1f;
+	Matrix44f projection = Matrix44f::zero();
+	projection(0, 0) = 1.f;
+	projection(1, 1) = 1.f;
+	projection(2, 2) = (far + near) / (near - far);
+	projection(2, 3) = 2.f * far * near / (near - far);
+	projection(3, 2) = -1.f;
+	Matrix44f view = Matrix44f::identity();
+	for (unsigned int i = 0; i < 3; i++)
+	{
+		view(i, 3) = -position[i];
+	}
+	return Frustum(projection * view);
+}
+
+void run(unsigned int numObjects)
+{
+	unsigned int const numQueries = 1000;
+	unsigned int const numFrames = 10;
+	float const worldSize = 10.f * std::cbrt((float)numObjects); // about one object per 1000 cubic units
+	float const querySize = 20.f;
+	std::string const suffix = ", " + std::to_string(numObjects) + " objects";
+
+	std::mt19937 random(1);
+	std::uniform_real_distribution<float> position(0.f, worldSize);
+	std::uniform_real_distribution<float> size(0.5f, 2.f);
+	std::uniform_real_distribution<float> jitter(-0.05f, 0.05f);
+
+	std::vector<Boxf> boxes(numObjects);
+	for (unsigned int i = 0; i < numObjects; i++)
+	{
+		Vector3f min = {position(random), position(random), position(random)};
+		boxes[i] = Boxf(min, min + Vector3f{size(random), size(random), size(random)});
+	}
+	std::vector<Vector3f> queryPositions(numQueries);
+	for (unsigned int i = 0; i < numQueries; i++)
+	{
+		queryPositions[i] = {position(random), position(random), position(random)};
+	}
+
+	Bvh<unsigned int> bvh;
+	std::vector<unsigned int> ids(numObjects);
+	double seconds = bench::measure([&]()
+	{
+		for (unsigned int i = 0; i < numObjects; i++)
+		{
+			ids[i] = bvh.insert(boxes[i], i);
+		}
+	}, 1);
+	bench::report(("insert" + suffix).c_str(), numObjects, seconds);
+
+	std::vector<unsigned int> results;
+	size_t numFound = 0;
+	seconds = bench::measure([&]()
+	{
+		numFound = 0;
+		for (unsigned int i = 0; i < numQueries; i++)
+		{
+			Vector3f half = {querySize / 2, querySize / 2, querySize / 2};
+			results.clear();
+			bvh.findOverlapping(Boxf(queryPositions[i] - half, queryPositions[i] + half), results);
+			numFound += results.size();
+		}
+	});
+	bench::report(("box query" + suffix).c_str(), numQueries, seconds);
+	std::printf("  %.1f found per query\n", (double)numFound / numQueries);
+
+	// The full scan is slow, so only do a tenth of the queries.
+	seconds = bench::measure([&]()
+	{
+		numFound = 0;
+		for (unsigned int i = 0; i < numQueries / 10; i++)
+		{
+			Vector3f half = {querySize / 2, querySize / 2, querySize / 2};
+			Boxf query(queryPositions[i] - half, queryPositions[i] + half);
+			for (unsigned int j = 0; j < numObjects; j++)
+			{
+				if (boxes[j].intersects(query))
+				{
+					numFound++;
+				}
+			}
+		}
+	}, 1);
+	bench::report(("box query by full scan" + suffix).c_str(), numQueries / 10, seconds);
+	std::printf("  %.1f found per query\n", (double)numFound / (numQueries / 10));
+
+	seconds = bench::measure([&]()
+	{
+		numFound = 0;
+		for (unsigned int i = 0; i < numQueries; i++)
+		{
+			results.clear();
+			bvh.findOverlapping(Sphere3f(queryPositions[i], querySize / 2), results);
+			numFound += results.size();
+		}
+	});
+	bench::report(("sphere query" + suffix).c_str(), numQueries, seconds);
+	std::printf("  %.1f found per query\n", (double)numFound / numQueries);
+
+	std::vector<Frustum> frustums(numQueries);
+	for (unsigned int i = 0; i < numQueries; i++)
+	{
+		frustums[i] = getFrustum(queryPositions[i], querySize);
+	}
+	seconds = bench::measure([&]()
+	{
+		numFound = 0;
+		for (unsigned int i = 0; i < numQueries; i++)
+		{
+			results.clear();
+			bvh.findOverlapping(frustums[i], results);
+			numFound += results.size();
+		}
+	});
+	bench::report(("frustum query" + suffix).c_str(), numQueries, seconds);
+	std::printf("  %.1f found per query\n", (double)numFound / numQueries);
+
+	// Each frame every object moves a little, and one in a hundred jumps somewhere else.
+	seconds = bench::measure([&]()
+	{
+		for (unsigned int frame = 0; frame < numFrames; frame++)
+		{
+			for (unsigned int i = 0; i < numObjects; i++)
+			{
+				Vector3f offset;
+				if (i % 100 == frame)
+				{
+					offset = Vector3f{position(random), position(random), position(random)} - boxes[i].min;
+				}
+				else
+				{
+					offset = {jitter(random), jitter(random), jitter(random)};
+				}
+				boxes[i] = Boxf(boxes[i].min + offset, boxes[i].max + offset);
+				bvh.move(ids[i], boxes[i]);
+			}
+		}
+	}, 1);
+	bench::report(("move" + suffix).c_str(), numObjects * numFrames, seconds);
+
+	seconds = bench::measure([&]()
+	{
+		numFound = 0;
+		for (unsigned int i = 0; i < numQueries; i++)
+		{
+			Vector3f half = {querySize / 2, querySize / 2, querySize / 2};
+			results.clear();
+			bvh.findOverlapping(Boxf(queryPositions[i] - half, queryPositions[i] + half), results);
+			numFound += results.size();
+		}
+	});
+	bench::report(("box query after moves" + suffix).c_str(), numQueries, seconds);
+
+	seconds = bench::measure([&]()
+	{
+		bvh.rebuild();
+	}, 1);
+	bench::report(("rebuild" + suffix).c_str(), numObjects, seconds);
+}
+
+int main()
+{
+	run(10000);
+	run(100000);
+	run(1000000);
+	return 0;
+}
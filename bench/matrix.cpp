@@ -0,0 +1,25 @@
+// Compares the SSE and AVX specializations of the Matrix44f operations with the generic templates they replace.
+// Build it together with matrix_generic.cpp, which compiles the generic versions.
+
+#include "matrix_ops.hpp"
+
+namespace veGeneric
+{
+	namespace bench
+	{
+		void timeMatrixOps(char const * label);
+	}
+}
+
+int main()
+{
+#if defined(VE_SIMD_AVX)
+	ve::bench::timeMatrixOps("AVX");
+#elif defined(VE_SIMD_SSE)
+	ve::bench::timeMatrixOps("SSE");
+#else
+	ve::bench::timeMatrixOps("no SIMD");
+#endif
+	veGeneric::bench::timeMatrixOps("generic");
+	return 0;
+}
@@ -0,0 +1,15 @@
+// The generic versions of the Matrix44f operations for matrix.cpp to compare with. The ve namespace is renamed to veGeneric in this file,
+// so that these instantiations of the templates don't clash with the SIMD specializations.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <initializer_list>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define VE_NO_SIMD
+#define ve veGeneric
+#include "matrix_ops.hpp"
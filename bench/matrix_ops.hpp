@@ -0,0 +1,118 @@
+#pragma once
+
+// The timed Matrix44f operations. This is included by matrix.cpp, which has the SSE and AVX specializations,
+// and by matrix_generic.cpp, which defines VE_NO_SIMD and renames the ve namespace so that its generic versions don't clash with them.
+
+#include "bench.hpp"
+#include "util/matrix.hpp"
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ve
+{
+	namespace bench
+	{
+		// Times each operation on the same random matrices and vectors and prints the results, with the label after each name.
+		void timeMatrixOps(char const * label)
+		{
+			unsigned int const numMatrices = 1024;
+			unsigned int const numRounds = 1000;
+			unsigned int const numOps = numMatrices * numRounds;
+
+			// Random matrices with a large diagonal so that they are invertible.
+			std::mt19937 random(1);
+			std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+			std::vector<Matrix44f> matrices(numMatrices);
+			std::vector<Vector3f> vectors3(numMatrices);
+			std::vector<Vector4f> vectors4(numMatrices);
+			for (unsigned int i = 0; i < numMatrices; i++)
+			{
+				for (unsigned int j = 0; j < 16; j++)
+				{
+					matrices[i][j] = distribution(random) + (j % 5 == 0 ? 4.f : 0.f);
+				}
+				vectors3[i] = {distribution(random), distribution(random), distribution(random)};
+				vectors4[i] = {distribution(random), distribution(random), distribution(random), 1.f};
+			}
+			std::vector<Matrix44f> resultMatrices(numMatrices);
+			std::vector<Vector3f> resultVectors3(numMatrices);
+			std::vector<Vector4f> resultVectors4(numMatrices);
+
+			double seconds = measure([&]()
+			{
+				for (unsigned int round = 0; round < numRounds; round++)
+				{
+					for (unsigned int i = 0; i < numMatrices; i++)
+					{
+						resultMatrices[i] = matrices[i] * matrices[(i + round) % numMatrices];
+					}
+				}
+				keep(resultMatrices[0][0]);
+			});
+			report(("Matrix44f * Matrix44f, " + std::string(label)).c_str(), numOps, seconds);
+
+			seconds = measure([&]()
+			{
+				for (unsigned int round = 0; round < numRounds; round++)
+				{
+					for (unsigned int i = 0; i < numMatrices; i++)
+					{
+						resultVectors4[i] = matrices[i] * vectors4[(i + round) % numMatrices];
+					}
+				}
+				keep(resultVectors4[0][0]);
+			});
+			report(("Matrix44f * Vector4f, " + std::string(label)).c_str(), numOps, seconds);
+
+			seconds = measure([&]()
+			{
+				for (unsigned int round = 0; round < numRounds; round++)
+				{
+					for (unsigned int i = 0; i < numMatrices; i++)
+					{
+						resultVectors3[i] = matrices[i].transform(vectors3[(i + round) % numMatrices], 1.f);
+					}
+				}
+				keep(resultVectors3[0][0]);
+			});
+			report(("transform, " + std::string(label)).c_str(), numOps, seconds);
+
+			seconds = measure([&]()
+			{
+				for (unsigned int round = 0; round < numRounds; round++)
+				{
+					matrices[round % numMatrices].transform(vectors3.data(), resultVectors3.data(), numMatrices, 1.f);
+				}
+				keep(resultVectors3[0][0]);
+			});
+			report(("transform of an array, " + std::string(label)).c_str(), numOps, seconds);
+
+			seconds = measure([&]()
+			{
+				for (unsigned int round = 0; round < numRounds; round++)
+				{
+					for (unsigned int i = 0; i < numMatrices; i++)
+					{
+						resultMatrices[i] = matrices[i].transpose();
+					}
+				}
+				keep(resultMatrices[0][0]);
+			});
+			report(("transpose, " + std::string(label)).c_str(), numOps, seconds);
+
+			seconds = measure([&]()
+			{
+				for (unsigned int round = 0; round < numRounds; round++)
+				{
+					for (unsigned int i = 0; i < numMatrices; i++)
+					{
+						resultMatrices[i] = matrices[i].inverse();
+					}
+				}
+				keep(resultMatrices[0][0]);
+			});
+			report(("inverse, " + std::string(label)).c_str(), numOps, seconds);
+		}
+	}
+}
@@ -0,0 +1,144 @@
+// Compares OwnPtr::setNew, which puts the object and its counter in one allocation, with setRaw, which allocates them apart.
+// Also compares looking up Ptrs in a std::set, ordered by the address stored in the counter, with the previous ordering,
+// which called a virtual hash() on a counter allocated apart from the object. That previous counter is reproduced here.
+
+#include "bench.hpp"
+#include "util/ptr.hpp"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace ve;
+
+// A small object, like most of the ones kept in sets of Ptrs.
+struct Item
+{
+	Item(int value_) : value(value_) {}
+	int value;
+	float data[3] = {0, 0, 0};
+};
+
+// The counter as it was before, with the ordering done through a virtual call.
+class OldCounter
+{
+public:
+	virtual ~OldCounter() {}
+	virtual intptr_t hash() = 0;
+	int pc = 1;
+};
+
+template <typename T>
+class OldCounterTyped : public OldCounter
+{
+public:
+	OldCounterTyped(T * p_) : p(p_) {}
+	intptr_t hash() override { return (intptr_t)p; }
+	T * p;
+};
+
+// A Ptr as it was before, ordered the way PtrBase was.
+struct OldPtr
+{
+	Item * p;
+	OldCounter * c;
+
+	operator intptr_t() const
+	{
+		if (c == nullptr)
+		{
+			return 0;
+		}
+		return c->hash();
+	}
+
+	bool operator < (OldPtr const & ptr) const
+	{
+		return (intptr_t)*this < (intptr_t)ptr;
+	}
+};
+
+int main()
+{
+	unsigned int const numObjects = 1000000;
+	unsigned int const numInSet = 100000;
+
+	std::vector<OwnPtr<Item>> ownPtrs(numObjects);
+
+	double seconds = bench::measure([&]()
+	{
+		for (unsigned int i = 0; i < numObjects; i++)
+		{
+			ownPtrs[i].setNew((int)i);
+		}
+		for (unsigned int i = 0; i < numObjects; i++)
+		{
+			ownPtrs[i].setNull();
+		}
+	});
+	bench::report("setNew and setNull", numObjects, seconds);
+
+	seconds = bench::measure([&]()
+	{
+		for (unsigned int i = 0; i < numObjects; i++)
+		{
+			ownPtrs[i].setRaw(new Item((int)i));
+		}
+		for (unsigned int i = 0; i < numObjects; i++)
+		{
+			ownPtrs[i].setNull();
+		}
+	});
+	bench::report("setRaw (two allocations) and setNull", numObjects, seconds);
+
+	// Fill the sets, with the objects allocated the way each counter was.
+	std::vector<Ptr<Item>> ptrs(numInSet);
+	std::vector<OldPtr> oldPtrs(numInSet);
+	for (unsigned int i = 0; i < numInSet; i++)
+	{
+		ownPtrs[i].setNew((int)i);
+		ptrs[i] = ownPtrs[i];
+		oldPtrs[i].p = new Item((int)i);
+		oldPtrs[i].c = new OldCounterTyped<Item>(oldPtrs[i].p);
+	}
+	std::set<Ptr<Item>> ptrSet(ptrs.begin(), ptrs.end());
+	std::set<OldPtr> oldPtrSet(oldPtrs.begin(), oldPtrs.end());
+
+	// Look them up in a random order so that the lookups aren't helped by the cache.
+	std::mt19937 random(1);
+	std::vector<unsigned int> order(numInSet);
+	for (unsigned int i = 0; i < numInSet; i++)
+	{
+		order[i] = i;
+	}
+	std::shuffle(order.begin(), order.end(), random);
+
+	seconds = bench::measure([&]()
+	{
+		int sum = 0;
+		for (unsigned int i = 0; i < numInSet; i++)
+		{
+			sum += (*ptrSet.find(ptrs[order[i]]))->value;
+		}
+		bench::keep(sum);
+	});
+	bench::report("std::set<Ptr> find", numInSet, seconds);
+
+	seconds = bench::measure([&]()
+	{
+		int sum = 0;
+		for (unsigned int i = 0; i < numInSet; i++)
+		{
+			sum += oldPtrSet.find(oldPtrs[order[i]])->p->value;
+		}
+		bench::keep(sum);
+	});
+	bench::report("std::set<Ptr> find, virtual hash()", numInSet, seconds);
+
+	for (unsigned int i = 0; i < numInSet; i++)
+	{
+		delete oldPtrs[i].c;
+		delete oldPtrs[i].p;
+	}
+	return 0;
+}
@@ -0,0 +1,87 @@
+// Churns 100k models through a render::Scene: creating them, destroying them in a random order, and replacing a small part of them
+// every frame the way text areas do when their text changes. It uses the null GL backend so it needs no window.
+
+#include "bench.hpp"
+#include "render/open_gl.hpp"
+#include "render/scene.hpp"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace ve;
+
+int main()
+{
+	unsigned int const numModels = 100000;
+	unsigned int const numFrames = 100;
+	unsigned int const numReplacedPerFrame = numModels / 100;
+
+	render::glUseNullBackend(true);
+	render::glInitialize();
+
+	std::mt19937 random(1);
+	std::vector<Ptr<render::Model>> models;
+	models.reserve(numModels);
+	std::vector<unsigned int> order(numModels);
+	for (unsigned int i = 0; i < numModels; i++)
+	{
+		order[i] = i;
+	}
+
+	double createSeconds = 0;
+	double destroySeconds = 0;
+	double churnSeconds = 0;
+	double prepareSeconds = 0;
+	for (unsigned int repeat = 0; repeat < 5; repeat++)
+	{
+		render::Scene scene;
+		models.clear();
+
+		double seconds = bench::measure([&]()
+		{
+			for (unsigned int i = 0; i < numModels; i++)
+			{
+				models.push_back(scene.createModel());
+			}
+		}, 1);
+		createSeconds = (repeat == 0 ? seconds : std::min(createSeconds, seconds));
+
+		seconds = bench::measure([&]()
+		{
+			scene.prepare();
+		}, 1);
+		prepareSeconds = (repeat == 0 ? seconds : std::min(prepareSeconds, seconds));
+
+		// Each frame destroys some random models and creates as many new ones, then sorts the scene as rendering would.
+		seconds = bench::measure([&]()
+		{
+			for (unsigned int frame = 0; frame < numFrames; frame++)
+			{
+				for (unsigned int i = 0; i < numReplacedPerFrame; i++)
+				{
+					unsigned int index = random() % numModels;
+					scene.destroyModel(models[index]);
+					models[index] = scene.createModel();
+				}
+				scene.prepare();
+			}
+		}, 1);
+		churnSeconds = (repeat == 0 ? seconds : std::min(churnSeconds, seconds));
+
+		std::shuffle(order.begin(), order.end(), random);
+		seconds = bench::measure([&]()
+		{
+			for (unsigned int i = 0; i < numModels; i++)
+			{
+				scene.destroyModel(models[order[i]]);
+			}
+		}, 1);
+		destroySeconds = (repeat == 0 ? seconds : std::min(destroySeconds, seconds));
+	}
+
+	bench::report("create", numModels, createSeconds);
+	bench::report("prepare (sort all)", numModels, prepareSeconds);
+	bench::report("frame replacing 1% and preparing", numFrames, churnSeconds);
+	bench::report("destroy in random order", numModels, destroySeconds);
+	return 0;
+}
@@ -1,7 +1,9 @@
 #include "ve.hpp"
 #include "log.hpp"
 #include "util/profiler.hpp"
+#include "render/open_gl.hpp"
 #include <SDL.h>
+#include <algorithm>
 
 namespace ve
 {
@@ -16,18 +18,49 @@ namespace ve
 		// Initialize the log.
 		Log::initialize();
 
+		// Use the null backend if it is configured. It needs no display, so windows are headless and render nothing.
+		std::string backend = config.getChildAs<std::string>("backend", "opengl");
+		if (backend == "null")
+		{
+			render::glUseNullBackend(true);
+		}
+		else if (backend != "opengl")
+		{
+			throw std::runtime_error("Unknown backend '" + backend + "'. ");
+		}
+
 		// Initialize SDL.
-		if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_TIMER) == -1)
+		if (SDL_Init((render::glIsNullBackend() ? SDL_INIT_EVENTS : SDL_INIT_VIDEO) | SDL_INIT_TIMER) == -1)
 		{
 			throw std::runtime_error(std::string("Could not initialize SDL:	") + SDL_GetError() + ". ");
 		}
 
-		// Set the loop update time to the refresh rate.
-		SDL_DisplayMode sdlDisplayMode;
-		SDL_GetDisplayMode(0, 0, &sdlDisplayMode);
-		secondsPerUpdate = 1.0f / sdlDisplayMode.refresh_rate;
+		// Set the loop update time to the refresh rate, or to 60 hz when there is no display.
+		if (render::glIsNullBackend())
+		{
+			secondsPerUpdate = 1.0f / 60.0f;
+		}
+		else
+		{
+			SDL_DisplayMode sdlDisplayMode;
+			SDL_GetDisplayMode(0, 0, &sdlDisplayMode);
+			secondsPerUpdate = 1.0f / sdlDisplayMode.refresh_rate;
+		}
 
 		input.setNew();
+
+		// Pipeline the frames if it is configured.
+		pipelined = config.getChildAs<bool>("pipelined", false);
+
+		// Render on demand if it is configured.
+		onDemand = config.getChildAs<bool>("onDemand", false);
+
+		// Create the task scheduler.
+		int numThreads = config.getChildAs<int>("threads", 0);
+		taskScheduler.setNew(numThreads > 0 ? (unsigned int)numThreads : 0);
+
+		// Create the work queue with its budget per frame.
+		workQueue.setNew(config.getChildAs<float>("workBudget", 2.f) / 1000.f);
 	}
 
 	App::~App()
@@ -39,6 +72,10 @@ namespace ve
 
 		input.setNull();
 
+		taskScheduler.setNull();
+
+		workQueue.setNull();
+
 		SDL_Quit();
 
 		Log::finalize();
@@ -53,18 +90,45 @@ namespace ve
 	{
 		float lastFrameTime = (float)SDL_GetTicks() / 1000.0f;
 		float accumulator = 0.f;
+		bool replayPending = false; // When pipelined, the last frame has been recorded but not yet replayed.
+		bool idle = false; // True if the last frame rendered nothing and left no work, so the loop can wait.
 		looping = true;
 
 		while (looping)
 		{
-			float currentFrameTime = (float)SDL_GetTicks() / 1000.f;
-
 			// Handle events
 			//controllers::startFrame();
 			SDL_Event sdlEvent;
+
+			// While the last frame is still to be replayed, only the concurrent worlds handle the events now, since they don't use GL.
+			// The other handlers wait until after the replay, since they may destroy meshes, images, or uniform buffers that its commands use.
+			auto receiveSDLEvent = [this, replayPending](SDL_Event const & sdlEvent)
+			{
+				if (replayPending)
+				{
+					handleSDLEvent(sdlEvent, EventHandlers::CONCURRENT_WORLDS);
+					deferredSDLEvents.push_back(sdlEvent);
+				}
+				else
+				{
+					handleSDLEvent(sdlEvent);
+				}
+			};
+
+			// When there was nothing to render, wait for an event, but no longer than until the next update is due, instead of spinning.
+			if (idle)
+			{
+				float secondsUntilUpdate = secondsPerUpdate - accumulator - ((float)SDL_GetTicks() / 1000.f - lastFrameTime);
+				if (secondsUntilUpdate > 0 && SDL_WaitEventTimeout(&sdlEvent, (int)(secondsUntilUpdate * 1000.f) + 1))
+				{
+					receiveSDLEvent(sdlEvent);
+				}
+			}
+
+			float currentFrameTime = (float)SDL_GetTicks() / 1000.f;
 			while (SDL_PollEvent(&sdlEvent))
 			{
-				handleSDLEvent(sdlEvent);
+				receiveSDLEvent(sdlEvent);
 			}
 			//for(int i = 0; i < controllers::getNumControllers(); i++)
 			//{
@@ -82,33 +146,145 @@ namespace ve
 			// Update
 			while (accumulator >= secondsPerUpdate)
 			{
-				for (auto && window : windows)
+				// Destroy anything queued in the worlds here, since it may free GL resources. If the last frame is still to be replayed, it may use them, so wait.
+				if (!replayPending)
 				{
-					window->update(secondsPerUpdate);
+					for (auto && world : worlds)
+					{
+						world->processEraseQueues();
+					}
 				}
 
+				// The windows update on this thread, since their guis use the GL context, and so do the worlds, since their controllers may create objects. Worlds that are concurrent update on the worker threads instead.
+				// When pipelined, the last frame is replayed on this thread first and then the deferred events are handled, while the concurrent worlds update. The guis and the other worlds wait for both, since they may change what the frame uses.
+				updateGraph.clear();
+				unsigned int replayTask = 0;
+				if (replayPending)
+				{
+					replayTask = updateGraph.addTask([this]()
+					{
+						for (auto && window : windows)
+						{
+							window->replay();
+						}
+						handleDeferredSDLEvents();
+					}, true);
+				}
+				for (auto && window : windows)
+				{
+					unsigned int windowTask = updateGraph.addTask([this, window]()
+					{
+						window->update(secondsPerUpdate);
+					}, true);
+					if (replayPending)
+					{
+						updateGraph.addDependency(windowTask, replayTask);
+					}
+				}
 				for (auto && world : worlds)
 				{
-					world->update(secondsPerUpdate);
+					// A world with an update divisor only updates every few steps, with the time since its last update.
+					UpdateSchedule & schedule = world->getUpdateSchedule();
+					if (schedule.advance(numUpdates, secondsPerUpdate, nextWorldPhases))
+					{
+						float dt = secondsPerUpdate * schedule.getCurrentDivisor();
+						unsigned int worldTask = updateGraph.addTask([world, dt]()
+						{
+							world->update(dt);
+						}, !world->isUpdateConcurrent());
+						if (replayPending && !world->isUpdateConcurrent())
+						{
+							updateGraph.addDependency(worldTask, replayTask);
+						}
+					}
 				}
-
 				if (updateCallback)
 				{
-					updateCallback(secondsPerUpdate);
+					unsigned int numUpdateTasks = updateGraph.getNumTasks();
+					unsigned int updateCallbackTask = updateGraph.addTask([this]()
+					{
+						updateCallback(secondsPerUpdate);
+					}, true);
+					for (unsigned int i = 0; i < numUpdateTasks; i++)
+					{
+						updateGraph.addDependency(updateCallbackTask, i);
+					}
 				}
+				taskScheduler->run(updateGraph);
+				replayPending = false;
 
 				accumulator -= secondsPerUpdate;
+				numUpdates++;
+			}
+
+			// When pipelined, replay the last frame and handle the deferred events if there was no update to do it during, and then destroy what was queued while it was pending, since its commands may use it.
+			if (pipelined)
+			{
+				if (replayPending)
+				{
+					for (auto && window : windows)
+					{
+						window->replay();
+					}
+					handleDeferredSDLEvents();
+					replayPending = false;
+				}
+				for (auto && world : worlds)
+				{
+					world->processEraseQueues();
+				}
+				windows.processEraseQueue();
+				worlds.processEraseQueue();
+			}
+
+			// Spend the budget of the frame on the queued work, such as uploads. Meshes, images, and fonts don't know the scenes that show them, so on demand every window renders again while it runs.
+			if (workQueue->getNumJobs() > 0)
+			{
+				workQueue->run();
+				for (auto && window : windows)
+				{
+					window->markChanged();
+				}
+			}
+
+			// Resolve the entity transforms once per frame, now that nothing will move them before rendering.
+			// What is rendered is interpolated between the last two updates of each world by the time since the last one, so that it is smooth when there are fewer updates than frames.
+			for (auto && world : worlds)
+			{
+				UpdateSchedule const & schedule = world->getUpdateSchedule();
+				unsigned int divisor = std::max(schedule.getCurrentDivisor(), 1u);
+				world->updateTransforms(*taskScheduler);
+				world->updateRenderTransforms((schedule.getStepsSinceUpdate() * secondsPerUpdate + accumulator) / (divisor * secondsPerUpdate), *taskScheduler);
+				world->updateUniformBuffers();
 			}
 
+			render::Shader::resetNumUniformNameLookups();
+			render::Shader::resetNumSkippedUniformValues();
 			for (auto & window : windows)
 			{
 				window->preRender();
 			}
 
+			// Windows that can't be seen are skipped, and on demand so are those with nothing new to show.
+			unsigned int numWindowsRendered = 0;
 			for (auto const & window : windows)
 			{
-				window->render();
+				if (!window->isVisible() || (onDemand && !window->needsRender()))
+				{
+					continue;
+				}
+				if (pipelined)
+				{
+					window->record(*taskScheduler);
+				}
+				else
+				{
+					window->render(*taskScheduler);
+				}
+				numWindowsRendered++;
 			}
+			replayPending = pipelined && numWindowsRendered > 0;
+			idle = numWindowsRendered == 0 && workQueue->getNumJobs() == 0;
 
 			// The loop might have temporal aliasing if the secondsPerUpdate is much less than the render frame rate.
 			// This algorithm is from http://gafferongames.com/game-physics/fix-your-timestep.
@@ -116,8 +292,12 @@ namespace ve
 			accumulator += secondsPerLoop;
 			lastFrameTime = currentFrameTime;
 
-			// Do frame cleanup.
-			windows.processEraseQueue();
+			// Do frame cleanup. When pipelined, the frame just recorded may use what is queued, so it waits until after the replay.
+			if (!pipelined)
+			{
+				windows.processEraseQueue();
+				worlds.processEraseQueue();
+			}
 		}
 
 		if (quitCallback)
@@ -141,6 +321,16 @@ namespace ve
 		secondsPerUpdate = dt;
 	}
 
+	bool App::isPipelined() const
+	{
+		return pipelined;
+	}
+
+	bool App::isOnDemand() const
+	{
+		return onDemand;
+	}
+
 	float App::getSecondsPerLoop() const
 	{
 		return secondsPerLoop;
@@ -181,6 +371,16 @@ namespace ve
 		return input;
 	}
 
+	Ptr<TaskScheduler> App::getTaskScheduler() const
+	{
+		return taskScheduler;
+	}
+
+	Ptr<WorkQueue> App::getWorkQueue() const
+	{
+		return workQueue;
+	}
+
 	void App::setQuitCallback(std::function<void()> const & callback)
 	{
 		quitCallback = callback;
@@ -219,9 +419,10 @@ namespace ve
 	}
 
 	// This handles a single SDL_Event. Lots of things happen here.
-	void App::handleSDLEvent(SDL_Event const & sdlEvent)
+	void App::handleSDLEvent(SDL_Event const & sdlEvent, EventHandlers handlers)
 	{
 		Ptr<Window> window;
+		bool concurrentWorldsOnly = (handlers == EventHandlers::CONCURRENT_WORLDS);
 
 		// Certain events are associated with a window. Get that window.
 		switch (sdlEvent.type)
@@ -245,23 +446,38 @@ namespace ve
 		switch (sdlEvent.type)
 		{
 			case SDL_QUIT:
-				if (requestQuitCallback)
+				if (requestQuitCallback && !concurrentWorldsOnly)
 				{
 					requestQuitCallback();
 				}
 				break;
 			case SDL_WINDOWEVENT:
-				switch (sdlEvent.window.event)
+				if (!concurrentWorldsOnly)
 				{
-					case SDL_WINDOWEVENT_CLOSE:
-						window->onCloseRequested();
-						break;
-					case SDL_WINDOWEVENT_SIZE_CHANGED:
-						window->onResized({sdlEvent.window.data1, sdlEvent.window.data2});
-						break;
-					case SDL_WINDOWEVENT_LEAVE:
-						window->onCursorPositionChanged(std::nullopt);
-						break;
+					switch (sdlEvent.window.event)
+					{
+						case SDL_WINDOWEVENT_CLOSE:
+							window->onCloseRequested();
+							break;
+						case SDL_WINDOWEVENT_SIZE_CHANGED:
+							window->onResized({sdlEvent.window.data1, sdlEvent.window.data2});
+							break;
+						case SDL_WINDOWEVENT_MINIMIZED:
+						case SDL_WINDOWEVENT_HIDDEN:
+							window->onVisibilityChanged(false);
+							break;
+						case SDL_WINDOWEVENT_RESTORED:
+						case SDL_WINDOWEVENT_MAXIMIZED:
+						case SDL_WINDOWEVENT_SHOWN:
+							window->onVisibilityChanged(true);
+							break;
+						case SDL_WINDOWEVENT_EXPOSED:
+							window->onExposed();
+							break;
+						case SDL_WINDOWEVENT_LEAVE:
+							window->onCursorPositionChanged(std::nullopt);
+							break;
+					}
 				}
 			case SDL_KEYDOWN:
 			case SDL_KEYUP:
@@ -281,9 +497,12 @@ namespace ve
 					}
 					for (auto && world : worlds)
 					{
-						world->handleInputEvent(inputEvent);
+						if (handlers == EventHandlers::ALL || world->isUpdateConcurrent() == concurrentWorldsOnly)
+						{
+							world->handleInputEvent(inputEvent);
+						}
 					}
-					if (inputEventCallback)
+					if (inputEventCallback && !concurrentWorldsOnly)
 					{
 						inputEventCallback(inputEvent);
 					}
@@ -292,5 +511,14 @@ namespace ve
 			}
 		}
 	}
+
+	void App::handleDeferredSDLEvents()
+	{
+		for (auto && sdlEvent : deferredSDLEvents)
+		{
+			handleSDLEvent(sdlEvent, EventHandlers::ALL_BUT_CONCURRENT_WORLDS);
+		}
+		deferredSDLEvents.clear();
+	}
 }
 
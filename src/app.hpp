@@ -4,6 +4,8 @@
 #include "world/world.hpp"
 #include "input.hpp"
 #include "util/ptr_set.hpp"
+#include "util/task_scheduler.hpp"
+#include "util/work_queue.hpp"
 
 union SDL_Event;
 
@@ -51,6 +53,24 @@ namespace ve
 		//! Returns the input system.
 		Ptr<Input> getInput() const;
 
+		//! Returns the task scheduler. Its number of threads is the 'threads' config value, or the number of hardware threads if it is 0 or missing.
+		Ptr<TaskScheduler> getTaskScheduler() const;
+
+		//! Returns the work queue, which runs slices of its jobs each frame, after the updates and before rendering, until its budget is used.
+		//! The budget is the 'workBudget' config value in milliseconds, or 2 if missing. Use it for expensive work like loading, so that it doesn't cause a hitch.
+		Ptr<WorkQueue> getWorkQueue() const;
+
+		//! Returns true if frames are pipelined, which is the 'pipelined' config value, false if missing.
+		//! When pipelined, each frame is recorded after the update and its GL calls are made during the next frame's update, at the cost of a frame of latency.
+		//! Only the worlds that call setUpdateConcurrent(true) update on the worker threads while the frame is replayed, so the overlap only applies to them.
+		//! The guis, the other worlds, and the other handlers of the events wait for the replay, since they may destroy what its commands use. Objects queued for erase in the worlds are destroyed once per frame.
+		bool isPipelined() const;
+
+		//! Returns true if the windows render on demand, which is the 'onDemand' config value, false if missing. This suits tools, which would otherwise use a core each.
+		//! On demand, a window only renders when its gui, a scene it shows, or a target it depends on has changed, when it has requested frames for an animation, or when the work queue has jobs.
+		//! When there is nothing to render, the loop waits for events or for the next update instead of spinning. Windows that are minimized or hidden never render, whatever the mode.
+		bool isOnDemand() const;
+
 		//! Sets the quit callback. Called right after the game loop exits. Use this to clean up your application.
 		void setQuitCallback(std::function<void()> const & callback);
 
@@ -64,13 +84,27 @@ namespace ve
 		void setRequestQuitCallback(std::function<void()> const & callback);
 
 	private:
+		// Which handlers of an event to call. While a pipelined frame is still to be replayed, the concurrent worlds handle the events before the replay and the rest after it.
+		enum class EventHandlers { ALL, CONCURRENT_WORLDS, ALL_BUT_CONCURRENT_WORLDS };
+
 		Ptr<Window> getWindowFromId(unsigned int id);
-		void handleSDLEvent(SDL_Event const & sdlEvent);
+		void handleSDLEvent(SDL_Event const & sdlEvent, EventHandlers handlers = EventHandlers::ALL);
+
+		// Calls the handlers of the deferred events that were left until after the replay.
+		void handleDeferredSDLEvents();
 
 		bool looping = false;
+		bool pipelined = false;
+		bool onDemand = false;
 		float secondsPerUpdate = 1.f / 24.f;
 		float secondsPerLoop = 0;
+		unsigned int numUpdates = 0;
+		std::map<unsigned int, unsigned int> nextWorldPhases; // The phase the next world with a divisor gets, so that they take turns.
 		OwnPtr<Input> input;
+		OwnPtr<TaskScheduler> taskScheduler;
+		OwnPtr<WorkQueue> workQueue; // Declared before the windows and worlds, so that what they own can cancel its jobs when destroyed.
+		TaskScheduler::Graph updateGraph;
+		std::vector<SDL_Event> deferredSDLEvents; // The events received while a pipelined frame was still to be replayed, to be handled after it by all but the concurrent worlds.
 		PtrSet<Window> windows;
 		PtrSet<world::World> worlds;
 
@@ -3,6 +3,7 @@
 namespace ve
 {
 	OwnPtr<render::Shader> Gui::shaderShared;
+	render::Shader::UniformId const guiSizeUniformId = render::Shader::getUniformId("guiSize");
 
 	Gui::Gui()
 	{
@@ -12,7 +13,7 @@ namespace ve
 		scene->setUniformsFunction([this](Ptr<render::Shader> const & shader)
 		{
 			Recti bounds = this->getRootPanel()->getBounds();
-			shader->setUniformValue<Vector2f>("guiSize", (Vector2f)(bounds.max - bounds.min + Vector2i {1, 1}));
+			shader->setUniformValue<Vector2f>(guiSizeUniformId, (Vector2f)(bounds.max - bounds.min + Vector2i {1, 1}));
 		});
 		root.setNew(scene, shader);
 		root->setDepth(0);
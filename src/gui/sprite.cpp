@@ -92,5 +92,6 @@ namespace ve
 			0, (float)bounds.getSize()[1], (float)imageOffset[0], (float)imageOffset[1] + bounds.getSize()[1]
 		};
 		mesh->setVertices(0, vertices, sizeof(float) * 4, false);
+		getScene()->markChanged(); // The scene can't see changes to the mesh.
 	}
 }
\ No newline at end of file
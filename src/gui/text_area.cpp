@@ -41,6 +41,7 @@ namespace ve
 	void TextArea::setColor(Vector4f color_)
 	{
 		color = color_;
+		getScene()->markChanged();
 	}
 
 	float TextArea::getDepth() const
@@ -65,6 +66,7 @@ namespace ve
 	void TextArea::setBounds(Recti bounds_)
 	{
 		bounds = bounds_;
+		getScene()->markChanged();
 	}
 
 	void TextArea::onCursorPositionChanged(std::optional<Vector2i> cursorPosition)
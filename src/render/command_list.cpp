@@ -0,0 +1,112 @@
+#include "render/command_list.hpp"
+#include "render/image.hpp"
+#include "render/mesh.hpp"
+#include "render/uniform_buffer.hpp"
+
+namespace ve
+{
+	namespace render
+	{
+		// The list recording on the current thread.
+		thread_local CommandList * recordingCommandList = nullptr;
+
+		void CommandList::beginRecording()
+		{
+			commands.clear();
+			values.clear();
+			transforms.clear();
+			lastShader = nullptr;
+			recordingCommandList = this;
+		}
+
+		void CommandList::endRecording()
+		{
+			if (recordingCommandList == this)
+			{
+				recordingCommandList = nullptr;
+			}
+		}
+
+		CommandList * CommandList::getRecording()
+		{
+			return recordingCommandList;
+		}
+
+		bool CommandList::useShader(Shader * shader)
+		{
+			if (lastShader == shader)
+			{
+				return false;
+			}
+			commands.push_back({USE_SHADER, shader, 0, 0, 0, nullptr});
+			lastShader = shader;
+			return true;
+		}
+
+		void CommandList::bindImage(unsigned int slot, Image const * image)
+		{
+			commands.push_back({BIND_IMAGE, image, (int)slot, 0, 0, nullptr});
+		}
+
+		void CommandList::unbindImages(unsigned int slot)
+		{
+			commands.push_back({UNBIND_IMAGES, nullptr, (int)slot, 0, 0, nullptr});
+		}
+
+		void CommandList::bindUniformBuffer(UniformBuffer const * uniformBuffer)
+		{
+			commands.push_back({BIND_UNIFORM_BUFFER, uniformBuffer, 0, 0, 0, nullptr});
+		}
+
+		void CommandList::draw(Mesh * mesh)
+		{
+			commands.push_back({DRAW, mesh, 0, 0, 0, nullptr});
+		}
+
+		void CommandList::drawInstances(Mesh * mesh, Matrix44f const * transforms_, unsigned int numTransforms, int transformLocation)
+		{
+			if (numTransforms == 0)
+			{
+				return;
+			}
+			commands.push_back({DRAW_INSTANCES, mesh, transformLocation, (unsigned int)transforms.size(), numTransforms, nullptr});
+			transforms.insert(transforms.end(), transforms_, transforms_ + numTransforms);
+		}
+
+		void CommandList::replay() const
+		{
+			for (auto && command : commands)
+			{
+				switch (command.type)
+				{
+					case USE_SHADER:
+						((Shader *)command.object)->activate();
+						break;
+					case SET_UNIFORM_VALUE:
+						command.setUniformValue(command.index, &values[command.offset]);
+						break;
+					case BIND_IMAGE:
+						((Image const *)command.object)->activate((unsigned int)command.index);
+						break;
+					case UNBIND_IMAGES:
+						Image::deactivateRest((unsigned int)command.index);
+						break;
+					case BIND_UNIFORM_BUFFER:
+						((UniformBuffer const *)command.object)->bind();
+						break;
+					case DRAW:
+						((Mesh *)command.object)->render();
+						break;
+					case DRAW_INSTANCES:
+						((Mesh *)command.object)->renderInstances(&transforms[command.offset], command.count, command.index);
+						break;
+				}
+			}
+		}
+
+		unsigned int CommandList::getNumCommands() const
+		{
+			return (unsigned int)commands.size();
+		}
+	}
+}
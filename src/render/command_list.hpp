@@ -0,0 +1,103 @@
+#pragma once
+
+#include "render/shader.hpp"
+#include "util/matrix.hpp"
+#include <vector>
+#include <cstdint>
+#include <cstring>
+
+namespace ve
+{
+	namespace render
+	{
+		class Mesh;
+		class Image;
+		class UniformBuffer;
+
+		// Internal to renderer. A list of render commands, such as shader changes, uniform values, texture binds and draws.
+		// Recording doesn't touch GL, so lists can be recorded on worker threads. The GL thread then replays them in order.
+		class CommandList final
+		{
+		public:
+			// Clears the commands and starts recording. Until endRecording(), uniform values set on this thread are recorded into this list instead of being sent to GL.
+			void beginRecording();
+
+			// Stops recording.
+			void endRecording();
+
+			// Returns the list that is recording on this thread, or null if there is none.
+			static CommandList * getRecording();
+
+			// Records the use of the shader. Returns true if it isn't the shader last used in the list, so that its uniforms need setting.
+			bool useShader(Shader * shader);
+
+			// Records a uniform value of the shader last used.
+			template <typename T> void setUniformValue(int location, T const & value);
+
+			// Records the binding of the image to the texture slot.
+			void bindImage(unsigned int slot, Image const * image);
+
+			// Records the unbinding of the textures at the slot and every slot after it.
+			void unbindImages(unsigned int slot);
+
+			// Records the binding of the uniform buffer.
+			void bindUniformBuffer(UniformBuffer const * uniformBuffer);
+
+			// Records a draw of the mesh.
+			void draw(Mesh * mesh);
+
+			// Records an instanced draw of the mesh with a transform per instance. The transforms are copied.
+			void drawInstances(Mesh * mesh, Matrix44f const * transforms, unsigned int numTransforms, int transformLocation);
+
+			// Sends the commands to GL. Called on the GL thread.
+			void replay() const;
+
+			// Returns the number of commands recorded.
+			unsigned int getNumCommands() const;
+
+		private:
+			enum Type { USE_SHADER, SET_UNIFORM_VALUE, BIND_IMAGE, UNBIND_IMAGES, BIND_UNIFORM_BUFFER, DRAW, DRAW_INSTANCES };
+
+			struct Command
+			{
+				Type type;
+				void const * object; // The shader, image, uniform buffer or mesh.
+				int index; // The uniform location, the texture slot or the transform location.
+				unsigned int offset; // The offset of the uniform value in values or of the first transform in transforms.
+				unsigned int count; // The number of transforms.
+				void (*setUniformValue)(int location, void const * value); // Sets the value with the type it was recorded with.
+			};
+
+			// Sets the uniform value of the type T that was copied to value.
+			template <typename T> static void replayUniformValue(int location, void const * value);
+
+			std::vector<Command> commands;
+			std::vector<uint8_t> values;
+			std::vector<Matrix44f> transforms;
+			Shader const * lastShader = nullptr;
+		};
+
+		template <typename T>
+		void CommandList::setUniformValue(int location, T const & value)
+		{
+			Command command;
+			command.type = SET_UNIFORM_VALUE;
+			command.object = nullptr;
+			command.index = location;
+			command.offset = (unsigned int)values.size();
+			command.count = 0;
+			command.setUniformValue = &replayUniformValue<T>;
+			values.resize(values.size() + sizeof(T));
+			std::memcpy(&values[command.offset], &value, sizeof(T));
+			commands.push_back(command);
+		}
+
+		template <typename T>
+		void CommandList::replayUniformValue(int location, void const * value)
+		{
+			T t;
+			std::memcpy(&t, value, sizeof(T)); // The values aren't aligned.
+			Shader::setUniformValue<T>(location, t);
+		}
+	}
+}
@@ -42,6 +42,11 @@ namespace ve
 
 		Font::~Font()
 		{
+			for (auto && pair : pendingBlocks)
+			{
+				pair.second.workQueue->cancel(pair.second.job);
+				SDL_FreeSurface((SDL_Surface *)pair.second.sdlSurface);
+			}
 			TTF_CloseFont((TTF_Font *)ttfFont);
 			numFontsLoaded--;
 			if (numFontsLoaded == 0)
@@ -73,41 +78,95 @@ namespace ve
 			auto blockIt = blocks.find(blockStart);
 			if (blockIt == blocks.end())
 			{
-				loadBlock(blockStart);
+				auto pendingBlockIt = pendingBlocks.find(blockStart);
+				if (pendingBlockIt != pendingBlocks.end())
+				{
+					pendingBlockIt->second.workQueue->finish(pendingBlockIt->second.job);
+				}
+				else
+				{
+					loadBlock(blockStart);
+				}
 				blockIt = blocks.find(blockStart);
 			}
 			return blockIt->second;
 		}
 
+		void Font::preloadBlock(unsigned int c, WorkQueue & workQueue)
+		{
+			int blockStart = c / (numCharsInCol * numCharsInRow) * (numCharsInCol * numCharsInRow);
+			if (blocks.find(blockStart) != blocks.end() || pendingBlocks.find(blockStart) != pendingBlocks.end())
+			{
+				return;
+			}
+			PendingBlock & pendingBlock = pendingBlocks[blockStart];
+			pendingBlock.sdlSurface = startBlock(pendingBlock.block, blockStart);
+			pendingBlock.numGlyphsRendered = 0;
+			pendingBlock.workQueue = &workQueue;
+			pendingBlock.job = workQueue.submit([this, blockStart]() -> bool
+			{
+				PendingBlock & pendingBlock = pendingBlocks[blockStart];
+				for (unsigned int i = 0; i < numCharsInRow && pendingBlock.numGlyphsRendered < pendingBlock.block.glyphCoords.size(); i++)
+				{
+					renderGlyph(pendingBlock.block, pendingBlock.sdlSurface, pendingBlock.numGlyphsRendered);
+					pendingBlock.numGlyphsRendered++;
+				}
+				if (pendingBlock.numGlyphsRendered < pendingBlock.block.glyphCoords.size())
+				{
+					return false;
+				}
+				finishBlock(pendingBlock.block, pendingBlock.sdlSurface);
+				pendingBlocks.erase(blockStart);
+				return true;
+			});
+		}
+
 		void Font::loadBlock(int blockStart)
 		{
-			// Create a image for a block of characters starting with the blockStart.
 			Block block;
+			void * sdlSurface = startBlock(block, blockStart);
+			for (unsigned int i = 0; i < block.glyphCoords.size(); i++)
+			{
+				renderGlyph(block, sdlSurface, i);
+			}
+			finishBlock(block, sdlSurface);
+		}
+
+		void * Font::startBlock(Block & block, int blockStart)
+		{
+			// Create a image for a block of characters starting with the blockStart.
 			unsigned int numCharsInBlock = numCharsInRow * numCharsInCol;
+			block.start = blockStart;
 			block.glyphCoords.resize(numCharsInBlock);
+			return SDL_CreateRGBSurface(0, cellSize * numCharsInRow, cellSize * numCharsInCol, 32, 0x000000ff, 0x0000ff00, 0x00ff0000, 0xff000000);
+		}
+
+		void Font::renderGlyph(Block & block, void * sdlSurface, unsigned int i)
+		{
 			SDL_Color white = {255, 255, 255, 255};
-			SDL_Surface * surface = SDL_CreateRGBSurface(0, cellSize * numCharsInRow, cellSize * numCharsInCol, 32, 0x000000ff, 0x0000ff00, 0x00ff0000, 0xff000000);
-			for (unsigned int i = 0; i < numCharsInBlock; i++)
+			int available = TTF_GlyphIsProvided((TTF_Font *)ttfFont, block.start + i);
+			SDL_Surface * glyphSurface = TTF_RenderGlyph_Blended((TTF_Font *)ttfFont, block.start + i, white);
+			int minX, maxY, advance, minY;
+			TTF_GlyphMetrics((TTF_Font *)ttfFont, block.start + i, &minX, nullptr, &minY, &maxY, &advance);
+			if (glyphSurface != nullptr)
 			{
-				int available = TTF_GlyphIsProvided((TTF_Font *)ttfFont, blockStart + i);
-				SDL_Surface * glyphSurface = TTF_RenderGlyph_Blended((TTF_Font *)ttfFont, blockStart + i, white);
-				int minX, maxY, advance, minY;
-				TTF_GlyphMetrics((TTF_Font *)ttfFont, blockStart + i, &minX, nullptr, &minY, &maxY, &advance);
-				if (glyphSurface != nullptr)
-				{
-					auto & coords = block.glyphCoords[i];
-					coords.offset = {0, -ascent};
-					coords.uvBounds.min = {(int)((i % numCharsInRow) * cellSize),(int)((i / numCharsInRow) * cellSize)};
-					coords.uvBounds.setSize({glyphSurface->w, glyphSurface->h});
-					coords.advance = advance;
-					SDL_Rect rect;
-					rect.x = coords.uvBounds.min[0];
-					rect.y = coords.uvBounds.min[1];
-					SDL_BlitSurface(glyphSurface, 0, surface, &rect);
-					SDL_FreeSurface(glyphSurface);
-				}
+				auto & coords = block.glyphCoords[i];
+				coords.offset = {0, -ascent};
+				coords.uvBounds.min = {(int)((i % numCharsInRow) * cellSize),(int)((i / numCharsInRow) * cellSize)};
+				coords.uvBounds.setSize({glyphSurface->w, glyphSurface->h});
+				coords.advance = advance;
+				SDL_Rect rect;
+				rect.x = coords.uvBounds.min[0];
+				rect.y = coords.uvBounds.min[1];
+				SDL_BlitSurface(glyphSurface, 0, (SDL_Surface *)sdlSurface, &rect);
+				SDL_FreeSurface(glyphSurface);
 			}
-			std::string resourceName = TTF_FontFaceFamilyName((TTF_Font *)ttfFont) + std::to_string(blockStart);
+		}
+
+		void Font::finishBlock(Block & block, void * sdlSurface)
+		{
+			SDL_Surface * surface = (SDL_Surface *)sdlSurface;
+			std::string resourceName = TTF_FontFaceFamilyName((TTF_Font *)ttfFont) + std::to_string(block.start);
 			block.image = OwnPtr<Image>::returnNew(Vector2i{surface->w, surface->h}, Image::RGBA32);
 			std::vector<uint8_t> pixels;
 			pixels.resize(surface->pitch * surface->h);
@@ -115,8 +174,7 @@ namespace ve
 			block.image->setPixels(pixels);
 			block.image->save("test.png");
 			SDL_FreeSurface(surface);
-			block.start = blockStart;
-			blocks[blockStart] = std::move(block);
+			blocks[block.start] = std::move(block);
 		}
 
 		//void Font::getInfoFromChar(unsigned int c, GlyphInfo & glyphInfo)
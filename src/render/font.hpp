@@ -3,6 +3,7 @@
 #include "render/image.hpp"
 #include "util/ptr.hpp"
 #include "util/rect.hpp"
+#include "util/work_queue.hpp"
 #include <string>
 #include <map>
 
@@ -35,6 +36,10 @@ namespace ve
 			//! Get image containing the character's glyph.
 			Ptr<Image> getImageFromChar(unsigned int c);
 
+			//! Queues the loading of the block of glyphs containing the character on the work queue, a row of glyphs per slice, so that it is ready before it is needed without a hitch.
+			//! If a glyph in it is needed before then, the rest is loaded right away. The font must be destroyed before the work queue.
+			void preloadBlock(unsigned int c, WorkQueue & workQueue);
+
 			//! Creates a series of models for rendering the given text and calculates the text size.
 			//void getModelsFromText(std::string const & text, std::vector<Ptr<Model>> & models, Vector2i & textSize);
 
@@ -46,16 +51,36 @@ namespace ve
 				std::vector<GlyphCoords> glyphCoords;
 			};
 
+			// A block whose glyphs are being rendered on a work queue.
+			struct PendingBlock
+			{
+				Block block;
+				void * sdlSurface;
+				unsigned int numGlyphsRendered;
+				WorkQueue * workQueue;
+				unsigned int job;
+			};
+
 			Block const & getBlock(unsigned int c);
 
 			void loadBlock(int blockStart);
 
+			// Starts the block, returning the SDL surface its glyphs are rendered to.
+			void * startBlock(Block & block, int blockStart);
+
+			// Renders the glyph at index i in the block to the surface.
+			void renderGlyph(Block & block, void * sdlSurface, unsigned int i);
+
+			// Creates the image of the block from the surface, frees the surface, and adds the block to the loaded blocks.
+			void finishBlock(Block & block, void * sdlSurface);
+
 			static unsigned int numFontsLoaded;
 			static unsigned int numCharsInRow;
 			static unsigned int numCharsInCol;
 			int cellSize;
 			void * ttfFont;
 			std::map<int, Block> blocks;
+			std::map<int, PendingBlock> pendingBlocks;
 			int size;
 			int lineHeight;
 			int ascent;
@@ -7,4 +7,6 @@ with open('glcorearb.h', 'r') as file:
 			function_prototype = 'PFN' + function.upper() + 'PROC'
 			#print('extern ' + function_prototype + ' ' + function + ';')
 			# print(function_prototype + ' ' + function + ';')
+			# print(function + 'Id,')
+			# print('VE_NULL_FUNCTION(' + function + ', ' + function_prototype + ');')
 			print(function + ' = (' + function_prototype + ')SDL_GL_GetProcAddress("' + function + '");')
\ No newline at end of file
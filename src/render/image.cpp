@@ -1,5 +1,6 @@
 #include "render/image.hpp"
 #include "render/open_gl.hpp"
+#include "render/state_cache.hpp"
 #include "util/math.hpp"
 #include <SDL_image.h>
 
@@ -7,8 +8,6 @@ namespace ve
 {
 	namespace render
 	{
-		std::vector<unsigned int> boundGLTextureIds; // Currently bound GL Texture IDs.
-
 		Image::Image(Vector2i size_, Format format_)
 		{
 			size = size_;
@@ -50,9 +49,14 @@ namespace ve
 			SDL_FreeSurface(surface);
 		}
 
+		// The most bytes uploaded in a slice of the work queue.
+		unsigned int const bytesPerUploadSlice = 256 * 1024;
+
 		Image::~Image()
 		{
+			cancelUpload();
 			glDeleteTextures(1, &glId);
+			StateCache::onTextureDeleted(glId);
 		}
 
 		void Image::save(std::string const & filename) const
@@ -63,6 +67,7 @@ namespace ve
 			}
 
 			SDL_Surface * surface = SDL_CreateRGBSurface(0, size[0], size[1], bytesPerPixel * 8, 0x000000ff, 0x0000ff00, 0x00ff0000, 0xff000000);
+			StateCache::bindTexture(0, glId);
 			glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, surface->pixels);
 			int result = IMG_SavePNG(surface, filename.c_str());
 			SDL_FreeSurface(surface);
@@ -79,6 +84,7 @@ namespace ve
 
 		void Image::setSize(Vector2i size_)
 		{
+			cancelUpload();
 			size = size_;
 			initializeGLPixels(nullptr);
 		}
@@ -92,6 +98,7 @@ namespace ve
 		{
 			std::vector<uint8_t> pixels;
 			pixels.resize(size[0] * size[1] * bytesPerPixel);
+			StateCache::bindTexture(0, glId);
 			glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, &pixels[0]);
 			return pixels;
 		}
@@ -102,7 +109,8 @@ namespace ve
 			{
 				throw std::runtime_error("Error setting pixels. Wrong size for pixel data. ");
 			}
-			glBindTexture(GL_TEXTURE_2D, glId);
+			cancelUpload();
+			StateCache::bindTexture(0, glId);
 			if (pixels.size() > 0)
 			{
 				glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, size[0], size[1], glFormat, glType, &pixels[0]);
@@ -112,32 +120,60 @@ namespace ve
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 		}
 
-		void Image::activate(unsigned int slot) const
+		void Image::setPixels(std::vector<uint8_t> const & pixels, WorkQueue & workQueue)
 		{
-			if (slot >= boundGLTextureIds.size() || glId != boundGLTextureIds[slot])
+			if (size[0] * size[1] * bytesPerPixel != pixels.size())
 			{
-				glActiveTexture(GL_TEXTURE0 + slot);
-				glBindTexture(GL_TEXTURE_2D, glId);
-				if (slot >= boundGLTextureIds.size())
+				throw std::runtime_error("Error setting pixels. Wrong size for pixel data. ");
+			}
+			cancelUpload();
+			unsigned int bytesPerRow = size[0] * bytesPerPixel;
+			int rowsPerSlice = bytesPerRow > 0 ? (int)math::max(bytesPerUploadSlice / bytesPerRow, 1u) : 1;
+			int row = 0;
+			uploadQueue = &workQueue;
+			uploadJob = workQueue.submit([this, pixels, bytesPerRow, rowsPerSlice, row]() mutable -> bool
+			{
+				if (uploadGLId == 0)
 				{
-					boundGLTextureIds.resize(slot + 1);
+					glGenTextures(1, &uploadGLId);
+					initializeGLTexture(uploadGLId, nullptr);
 				}
-				boundGLTextureIds[slot] = glId;
-			}
+				StateCache::bindTexture(0, uploadGLId);
+				if (row < size[1])
+				{
+					int numRows = math::min(rowsPerSlice, size[1] - row);
+					glTexSubImage2D(GL_TEXTURE_2D, 0, 0, row, size[0], numRows, glFormat, glType, &pixels[row * bytesPerRow]);
+					row += numRows;
+					return false;
+				}
+				glGenerateMipmap(GL_TEXTURE_2D);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+				// Replace the old texture, now that the new one is complete.
+				glDeleteTextures(1, &glId);
+				StateCache::onTextureDeleted(glId);
+				glId = uploadGLId;
+				uploadGLId = 0;
+				uploadQueue = nullptr;
+				uploadJob = 0;
+				return true;
+			});
+		}
+
+		unsigned int Image::getGLId() const
+		{
+			return glId;
+		}
+
+		void Image::activate(unsigned int slot) const
+		{
+			StateCache::bindTexture(slot, glId);
 		}
 
 		void Image::deactivateRest(unsigned int slot)
 		{
-			for (; slot < boundGLTextureIds.size(); slot++)
-			{
-				if (boundGLTextureIds[slot] == 0)
-				{
-					break; // If this one is zero, the rest are zero.
-				}
-				glActiveTexture(GL_TEXTURE0 + slot);
-				glBindTexture(GL_TEXTURE_2D, 0);
-				boundGLTextureIds[slot] = 0;
-			}
+			StateCache::unbindTextures(slot);
 		}
 
 		void Image::attachToFrameBuffer(unsigned int attachment)
@@ -145,6 +181,22 @@ namespace ve
 			glFramebufferTexture(GL_FRAMEBUFFER, attachment, glId, 0);
 		}
 
+		void Image::cancelUpload()
+		{
+			if (uploadQueue != nullptr)
+			{
+				uploadQueue->cancel(uploadJob);
+				uploadQueue = nullptr;
+				uploadJob = 0;
+			}
+			if (uploadGLId != 0)
+			{
+				glDeleteTextures(1, &uploadGLId);
+				StateCache::onTextureDeleted(uploadGLId);
+				uploadGLId = 0;
+			}
+		}
+
 		void Image::initializeGLPixels(void const * pixels)
 		{
 			switch (format)
@@ -174,8 +226,12 @@ namespace ve
 					bytesPerPixel = 1;
 					break;
 			}
+			initializeGLTexture(glId, pixels);
+		}
 
-			glBindTexture(GL_TEXTURE_2D, glId);
+		void Image::initializeGLTexture(unsigned int id, void const * pixels)
+		{
+			StateCache::bindTexture(0, id);
 			if (size[0] > 0 && size[1] > 0)
 			{
 				glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, size[0], size[1], 0, glFormat, glType, pixels);
@@ -2,6 +2,7 @@
 
 #include "util/vector.hpp"
 #include "util/rect.hpp"
+#include "util/work_queue.hpp"
 #include <string>
 #include <vector>
 
@@ -45,6 +46,14 @@ namespace ve
 			// Sets the raw pixel data.
 			void setPixels(std::vector<uint8_t> const & pixels);
 
+			// Sets the raw pixel data on the work queue, a band of rows per slice, and then generates the mipmaps, so that a large image doesn't cause a hitch.
+			// The bands go into a second texture, which replaces the first when it is done, so until then the image keeps its old pixels.
+			// Since the GL id changes then, it is not for images attached to an image target. The image must be destroyed before the work queue.
+			void setPixels(std::vector<uint8_t> const & pixels, WorkQueue & workQueue);
+
+			// Internal to renderer. Returns the GL texture id.
+			unsigned int getGLId() const;
+
 			// Internal to renderer. Activates the texture in the GL slot.
 			void activate(unsigned int slot) const;
 
@@ -56,7 +65,9 @@ namespace ve
 
 		private:
 			void initializeGLPixels(void const * pixels);
+			void initializeGLTexture(unsigned int id, void const * pixels);
 			void loadFromSDLSurface(void const * sdlSurface);
+			void cancelUpload();
 
 			Vector2i size;
 			Format format;
@@ -65,6 +76,9 @@ namespace ve
 			unsigned int glType;
 			unsigned int glInternalFormat;
 			unsigned int bytesPerPixel;
+			WorkQueue * uploadQueue = nullptr;
+			unsigned int uploadJob = 0; // The queued job setting the pixels, if any.
+			unsigned int uploadGLId = 0; // The texture the job sets the pixels of, until it replaces the current one.
 		};
 	}
 }
\ No newline at end of file
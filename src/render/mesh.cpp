@@ -1,28 +1,53 @@
 #include "render/mesh.hpp"
 #include "render/open_gl.hpp"
+#include "render/state_cache.hpp"
+#include "util/math.hpp"
 
 namespace ve
 {
 	namespace render
 	{
+		// The vertices index used for the instance transforms.
+		unsigned int const instanceTransformsIndex = 15;
+
+		// The most bytes uploaded in a slice of the work queue.
+		unsigned int const bytesPerUploadSlice = 256 * 1024;
+
 		Mesh::Mesh()
 		{
 			numIndicesPerPrimitive = 3;
 			numIndicesInInstance = 0;
 			numInstances = 1;
 			glMode = GL_TRIANGLES;
+			positionVerticesIndex = 0;
+			positionByteOffset = 0;
+			positionNumDimensions = 0;
+			boundsValid = false;
 			glGenVertexArrays(1, &vertexArrayObject);
 			glGenBuffers(1, &indexBufferObject);
+			instanceBufferObject = 0;
 		}
 
 		Mesh::~Mesh()
 		{
+			for (auto && pair : uploads)
+			{
+				pair.second.workQueue->cancel(pair.second.job);
+			}
 			for (auto && pair : vertexBufferObjects)
 			{
 				glDeleteBuffers(1, &pair.second);
+				StateCache::onBufferDeleted(pair.second);
 			}
 			glDeleteVertexArrays(1, &vertexArrayObject);
+			StateCache::onVertexArrayDeleted(vertexArrayObject);
 			glDeleteBuffers(1, &indexBufferObject);
+			StateCache::onBufferDeleted(indexBufferObject);
+			if (instanceBufferObject != 0)
+			{
+				glDeleteBuffers(1, &instanceBufferObject);
+				StateCache::onBufferDeleted(instanceBufferObject);
+			}
 		}
 
 		unsigned int Mesh::getNumIndicesPerPrimitive() const
@@ -48,10 +73,16 @@ namespace ve
 
 		void Mesh::setVertexComponent(unsigned int componentIndex, unsigned int numDimensions, unsigned int byteOffsetInVertex, unsigned int verticesIndex)
 		{
-			glBindVertexArray(vertexArrayObject);
+			StateCache::bindVertexArray(vertexArrayObject);
 			glEnableVertexAttribArray(componentIndex);
 			glVertexAttribFormat(componentIndex, numDimensions, GL_FLOAT, GL_FALSE, byteOffsetInVertex);
 			glVertexAttribBinding(componentIndex, verticesIndex);
+			if (componentIndex == 0)
+			{
+				positionVerticesIndex = verticesIndex;
+				positionByteOffset = byteOffsetInVertex;
+				positionNumDimensions = numDimensions;
+			}
 		}
 
 		void Mesh::setVertices(unsigned int index, std::vector<float> const & vertices, unsigned int byteSizeOfVertex, bool instanced)
@@ -59,52 +90,236 @@ namespace ve
 			auto & it = vertexBufferObjects.find(index);
 			if (vertices.size() > 0 && byteSizeOfVertex > 0)
 			{
-				unsigned int vertexBufferObject;
-				if (it == vertexBufferObjects.end())
-				{
-					glBindVertexArray(vertexArrayObject);
-					glGenBuffers(1, &vertexBufferObject);
-					glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject); // Even though this isn't required, my video card has a bug which does require it for glBindVertexBuffer.
-					glBindVertexBuffer(index, vertexBufferObject, 0, byteSizeOfVertex);
-					glVertexBindingDivisor(index, instanced ? 1 : 0);
-					vertexBufferObjects.insert(std::pair<unsigned int, unsigned int>(index, vertexBufferObject));
-				}
-				else
+				unsigned int vertexBufferObject = getVertexBufferObject(index, byteSizeOfVertex, instanced);
+				cancelUpload(vertexBufferObject);
+				StateCache::bindBuffer(GL_ARRAY_BUFFER, vertexBufferObject);
+				glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), (void const *)&vertices[0], GL_STATIC_DRAW);
+				if (index == positionVerticesIndex && positionNumDimensions > 0)
 				{
-					vertexBufferObject = it->second;
+					updatePositions(vertices, byteSizeOfVertex);
 				}
-				glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject);
-				glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), (void const *)&vertices[0], GL_STATIC_DRAW);
 			}
 			else if (it != vertexBufferObjects.end())
 			{
 				unsigned int vertexBufferObject = it->second;
+				cancelUpload(vertexBufferObject);
 				vertexBufferObjects.erase(it);
-				glBindVertexArray(vertexArrayObject);
+				StateCache::bindVertexArray(vertexArrayObject);
 				glDisableVertexAttribArray(index);
 				glBindVertexBuffer(index, 0, 0, 0);
 				glDeleteBuffers(1, &vertexBufferObject);
+				StateCache::onBufferDeleted(vertexBufferObject);
+				if (index == positionVerticesIndex)
+				{
+					positions.clear();
+					boundsValid = false;
+				}
 			}
 		}
 
-		void Mesh::setIndices(std::vector<unsigned int> const & indices)
+		void Mesh::setVertices(unsigned int index, std::vector<float> const & vertices, unsigned int byteSizeOfVertex, bool instanced, WorkQueue & workQueue)
 		{
+			if (vertices.size() == 0 || byteSizeOfVertex == 0)
+			{
+				setVertices(index, vertices, byteSizeOfVertex, instanced); // There is nothing to upload.
+				return;
+			}
+			unsigned int vertexBufferObject = getVertexBufferObject(index, byteSizeOfVertex, instanced);
+			queueUpload(GL_ARRAY_BUFFER, vertexBufferObject, (void const *)&vertices[0], (unsigned int)(vertices.size() * sizeof(float)), workQueue);
+			if (index == positionVerticesIndex && positionNumDimensions > 0)
+			{
+				updatePositions(vertices, byteSizeOfVertex);
+			}
+		}
+
+		std::vector<Vector3f> const & Mesh::getPositions() const
+		{
+			return positions;
+		}
+
+		std::vector<unsigned int> const & Mesh::getIndices() const
+		{
+			return indices;
+		}
+
+		bool Mesh::hasBounds() const
+		{
+			return boundsValid;
+		}
+
+		Boxf const & Mesh::getBounds() const
+		{
+			return bounds;
+		}
+
+		Sphere3f const & Mesh::getBoundingSphere() const
+		{
+			return boundingSphere;
+		}
+
+		void Mesh::setIndices(std::vector<unsigned int> const & indices_)
+		{
+			indices = indices_;
 			numIndicesInInstance = (unsigned int)indices.size();
-			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferObject);
+			cancelUpload(indexBufferObject);
+			StateCache::bindVertexArray(vertexArrayObject); // The index buffer binding is stored in the vertex array object.
+			StateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferObject);
 			glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), (void const *)&indices[0], GL_STATIC_DRAW);
 		}
 
+		void Mesh::setIndices(std::vector<unsigned int> const & indices_, WorkQueue & workQueue)
+		{
+			indices = indices_;
+			numIndicesInInstance = (unsigned int)indices.size();
+			queueUpload(GL_ELEMENT_ARRAY_BUFFER, indexBufferObject, indices.empty() ? nullptr : (void const *)&indices[0], (unsigned int)(indices.size() * sizeof(unsigned int)), workQueue);
+		}
+
 		void Mesh::setNumInstances(unsigned int numInstances_)
 		{
 			numInstances = numInstances_;
 		}
 
+		unsigned int Mesh::getGLVertexArrayObject() const
+		{
+			return vertexArrayObject;
+		}
+
+		unsigned int Mesh::getVertexBufferObject(unsigned int index, unsigned int byteSizeOfVertex, bool instanced)
+		{
+			auto it = vertexBufferObjects.find(index);
+			if (it != vertexBufferObjects.end())
+			{
+				return it->second;
+			}
+			unsigned int vertexBufferObject;
+			StateCache::bindVertexArray(vertexArrayObject);
+			glGenBuffers(1, &vertexBufferObject);
+			StateCache::bindBuffer(GL_ARRAY_BUFFER, vertexBufferObject); // Even though this isn't required, my video card has a bug which does require it for glBindVertexBuffer.
+			glBindVertexBuffer(index, vertexBufferObject, 0, byteSizeOfVertex);
+			glVertexBindingDivisor(index, instanced ? 1 : 0);
+			vertexBufferObjects.insert(std::pair<unsigned int, unsigned int>(index, vertexBufferObject));
+			return vertexBufferObject;
+		}
+
+		void Mesh::queueUpload(unsigned int target, unsigned int buffer, void const * data, unsigned int numBytes, WorkQueue & workQueue)
+		{
+			// The storage is allocated now and filled a chunk per slice. The element array buffer binding belongs to the vertex array object, so it is bound first.
+			cancelUpload(buffer);
+			StateCache::bindVertexArray(vertexArrayObject);
+			StateCache::bindBuffer(target, buffer);
+			glBufferData(target, numBytes, nullptr, GL_STATIC_DRAW);
+			if (numBytes == 0)
+			{
+				return;
+			}
+			std::vector<uint8_t> bytes((uint8_t const *)data, (uint8_t const *)data + numBytes);
+			unsigned int offset = 0;
+			unsigned int job = workQueue.submit([this, target, buffer, bytes, offset]() mutable -> bool
+			{
+				unsigned int numBytes = math::min(bytesPerUploadSlice, (unsigned int)bytes.size() - offset);
+				StateCache::bindVertexArray(vertexArrayObject);
+				StateCache::bindBuffer(target, buffer);
+				glBufferSubData(target, offset, numBytes, (void const *)&bytes[offset]);
+				offset += numBytes;
+				if (offset < bytes.size())
+				{
+					return false;
+				}
+				uploads.erase(buffer);
+				return true;
+			});
+			uploads[buffer] = Upload {&workQueue, job};
+		}
+
+		void Mesh::cancelUpload(unsigned int buffer)
+		{
+			auto it = uploads.find(buffer);
+			if (it != uploads.end())
+			{
+				it->second.workQueue->cancel(it->second.job);
+				uploads.erase(it);
+			}
+		}
+
+		void Mesh::updatePositions(std::vector<float> const & vertices, unsigned int byteSizeOfVertex)
+		{
+			// The vertex data isn't kept after it is uploaded, so the positions are copied out and the bounds are found now.
+			positions.clear();
+			boundsValid = false;
+			unsigned int stride = byteSizeOfVertex / sizeof(float);
+			unsigned int offset = positionByteOffset / sizeof(float);
+			unsigned int numDimensions = positionNumDimensions < 3 ? positionNumDimensions : 3;
+			if (stride == 0 || offset + numDimensions > vertices.size())
+			{
+				return;
+			}
+			unsigned int numVertices = (unsigned int)((vertices.size() - offset - numDimensions) / stride + 1);
+			positions.resize(numVertices, Vector3f {0, 0, 0});
+			for (unsigned int vertex = 0; vertex < numVertices; vertex++)
+			{
+				for (unsigned int i = 0; i < numDimensions; i++)
+				{
+					positions[vertex][i] = vertices[vertex * stride + offset + i];
+				}
+			}
+			bounds.min = bounds.max = positions[0];
+			for (auto && position : positions)
+			{
+				bounds = bounds.extendedTo(position);
+			}
+			boundingSphere.center = (bounds.min + bounds.max) / 2.f;
+			float radiusSq = 0;
+			for (auto && position : positions)
+			{
+				float distanceSq = (position - boundingSphere.center).normSq();
+				if (distanceSq > radiusSq)
+				{
+					radiusSq = distanceSq;
+				}
+			}
+			boundingSphere.radius = std::sqrt(radiusSq);
+			boundsValid = true;
+		}
+
 		void Mesh::render() const
 		{
-			glBindVertexArray(vertexArrayObject);
-			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferObject);
+			if (!uploads.empty())
+			{
+				return; // Its buffers are still being filled.
+			}
+			StateCache::bindVertexArray(vertexArrayObject);
 			glDrawElementsInstanced(glMode, numIndicesInInstance, GL_UNSIGNED_INT, 0, numInstances);
-			glBindVertexArray(0);
+		}
+
+		void Mesh::renderInstances(Matrix44f const * transforms, unsigned int numTransforms, int transformLocation)
+		{
+			if (numTransforms == 0 || transformLocation < 0 || !uploads.empty())
+			{
+				return;
+			}
+			if (instanceBufferObject == 0)
+			{
+				glGenBuffers(1, &instanceBufferObject);
+			}
+			// Respecifying the whole buffer lets the driver hand out new storage instead of waiting on draws still using the old transforms.
+			StateCache::bindBuffer(GL_ARRAY_BUFFER, instanceBufferObject);
+			glBufferData(GL_ARRAY_BUFFER, numTransforms * sizeof(Matrix44f), (void const *)transforms, GL_STREAM_DRAW);
+			StateCache::bindVertexArray(vertexArrayObject);
+			glBindVertexBuffer(instanceTransformsIndex, instanceBufferObject, 0, sizeof(Matrix44f));
+			glVertexBindingDivisor(instanceTransformsIndex, 1);
+			// A mat4 attribute takes four consecutive locations, one per column.
+			for (unsigned int column = 0; column < 4; column++)
+			{
+				glEnableVertexAttribArray(transformLocation + column);
+				glVertexAttribFormat(transformLocation + column, 4, GL_FLOAT, GL_FALSE, column * 4 * sizeof(float));
+				glVertexAttribBinding(transformLocation + column, instanceTransformsIndex);
+			}
+			glDrawElementsInstanced(glMode, numIndicesInInstance, GL_UNSIGNED_INT, 0, numTransforms);
+			// Leave the vertex array as the non-instanced draws of the mesh expect it.
+			for (unsigned int column = 0; column < 4; column++)
+			{
+				glDisableVertexAttribArray(transformLocation + column);
+			}
 		}
 	}
 }
\ No newline at end of file
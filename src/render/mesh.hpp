@@ -1,5 +1,9 @@
 #pragma once
 
+#include "util/box.hpp"
+#include "util/sphere.hpp"
+#include "util/matrix.hpp"
+#include "util/work_queue.hpp"
 #include <vector>
 #include <map>
 
@@ -24,24 +28,63 @@ namespace ve
 			void setNumIndicesPerPrimitive(unsigned int numIndices);
 
 			// Sets the vertex component of the given index. The component index is used for the glsl layout attribute specifier. If instanced, then each value for this component in the vertices will be per instance rather than per vertex.
+			// Component 0 is the position, which is used for the bounds. It should be set before its vertices.
 			void setVertexComponent(unsigned int componentIndex, unsigned int numDimensions, unsigned int byteOffsetInVertex, unsigned int verticesIndex);
 
-			// Sets the vertices at a given index.
+			// Sets the vertices at a given index. If they contain the positions, the bounds are updated.
 			void setVertices(unsigned int index, std::vector<float> const & vertices, unsigned int byteSizeOfVertex, bool instanced);
 
-			// Gets the indices.
+			// Sets the vertices at a given index on the work queue, a chunk per slice, so that a large mesh doesn't cause a hitch. The positions and bounds are updated now.
+			// The mesh doesn't render until all of its queued uploads are done. It must be destroyed before the work queue.
+			void setVertices(unsigned int index, std::vector<float> const & vertices, unsigned int byteSizeOfVertex, bool instanced, WorkQueue & workQueue);
+
+			// Returns true if the mesh has positions and therefore bounds.
+			bool hasBounds() const;
+
+			// Returns the axis-aligned box around the positions.
+			Boxf const & getBounds() const;
+
+			// Returns a sphere around the positions.
+			Sphere3f const & getBoundingSphere() const;
+
+			// Returns the positions, copied from the vertices when they were set, for use on the CPU such as for picking.
+			std::vector<Vector3f> const & getPositions() const;
+
+			// Returns the indices, copied when they were set.
 			std::vector<unsigned int> const & getIndices() const;
 
 			// Sets the indices of a single instance.
 			void setIndices(std::vector<unsigned int> const & indices);
 
+			// Sets the indices of a single instance on the work queue, a chunk per slice. The mesh doesn't render until all of its queued uploads are done.
+			void setIndices(std::vector<unsigned int> const & indices, WorkQueue & workQueue);
+
 			// Sets the number of instances to render.
 			void setNumInstances(unsigned int numInstances);
 
+			// Internal to renderer. Returns the GL vertex array object id.
+			unsigned int getGLVertexArrayObject() const;
+
 			// Renders the Mesh.
 			void render() const;
 
+			// Internal to renderer. Renders one instance of the mesh per transform, with the transforms uploaded as the mat4 vertex attribute at transformLocation.
+			// The transforms use vertices index 15 and the four component indices from transformLocation, so the mesh should not use them otherwise.
+			void renderInstances(Matrix44f const * transforms, unsigned int numTransforms, int transformLocation);
+
 		private:
+			// A buffer upload queued on a work queue.
+			struct Upload
+			{
+				WorkQueue * workQueue;
+				unsigned int job;
+			};
+
+			unsigned int getVertexBufferObject(unsigned int index, unsigned int byteSizeOfVertex, bool instanced);
+			void queueUpload(unsigned int target, unsigned int buffer, void const * data, unsigned int numBytes, WorkQueue & workQueue);
+			void cancelUpload(unsigned int buffer);
+			void updatePositions(std::vector<float> const & vertices, unsigned int byteSizeOfVertex);
+
 			unsigned int numIndicesPerPrimitive;
 			unsigned int numIndicesInInstance;
 			unsigned int numInstances;
@@ -49,6 +92,16 @@ namespace ve
 			unsigned int vertexArrayObject;
 			std::map<unsigned int, unsigned int> vertexBufferObjects;
 			unsigned int indexBufferObject;
+			unsigned int instanceBufferObject;
+			unsigned int positionVerticesIndex;
+			unsigned int positionByteOffset;
+			unsigned int positionNumDimensions;
+			std::vector<Vector3f> positions;
+			std::vector<unsigned int> indices;
+			bool boundsValid;
+			Boxf bounds;
+			Sphere3f boundingSphere;
+			std::map<unsigned int, Upload> uploads; // The queued upload of each buffer.
 		};
 	}
 }
@@ -1,11 +1,29 @@
 #include "render/model.hpp"
+#include "render/scene.hpp"
+#include <cstring>
 
 namespace ve
 {
 	namespace render
 	{
-		Model::Model()
+		Shader::UniformId const flipYUniformId = Shader::getUniformId("flipY");
+
+		// Returns the bits of the float as an unsigned int that sorts in the same order as the float.
+		uint32_t getSortableBits(float f)
 		{
+			uint32_t bits;
+			std::memcpy(&bits, &f, sizeof(bits));
+			return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+		}
+
+		Model::Model(Scene * scene_)
+		{
+			scene = scene_;
+			sceneIndex = 0;
+			sortKey = 0;
+			depth = 0;
+			instanceTransform = Matrix44f::identity();
+			uniformsFunctionTransformOnly = false;
 		}
 
 		float Model::getDepth() const
@@ -16,6 +34,8 @@ namespace ve
 		void Model::setDepth(float depth_)
 		{
 			depth = depth_;
+			updateSortKey();
+			scene->markChanged();
 		}
 
 		Ptr<Mesh> Model::getMesh() const
@@ -26,6 +46,8 @@ namespace ve
 		void Model::setMesh(Ptr<Mesh> const & mesh_)
 		{
 			mesh = mesh_;
+			updateSortKey();
+			scene->onModelBatchChanged();
 		}
 
 		Ptr<Shader> Model::getShader() const
@@ -36,6 +58,8 @@ namespace ve
 		void Model::setShader(Ptr<Shader> const & shader_)
 		{
 			shader = shader_;
+			updateSortKey();
+			scene->onModelBatchChanged();
 		}
 
 		Ptr<Image> Model::getImageAtSlot(unsigned int slot) const
@@ -57,20 +81,111 @@ namespace ve
 				images.resize(slot + 1);
 			}
 			images[slot] = image;
+			updateSortKey();
+			scene->onModelBatchChanged();
+		}
+
+		Sphere3f Model::getBoundingSphere() const
+		{
+			return scene->getModelBoundingSphere(sceneIndex);
+		}
+
+		void Model::setBoundingSphere(Sphere3f const & sphere)
+		{
+			scene->setModelBoundingSphere(sceneIndex, sphere);
 		}
 
-		void Model::setUniformsFunction(std::function<void(Ptr<Shader> const &)> const & uniformsFunction_)
+		Matrix44f const & Model::getInstanceTransform() const
+		{
+			return instanceTransform;
+		}
+
+		void Model::setInstanceTransform(Matrix44f const & transform)
+		{
+			instanceTransform = transform;
+			scene->markChanged();
+		}
+
+		bool Model::isInstanced() const
+		{
+			return shader.isValid() && shader->getInstanceTransformLocation() != -1;
+		}
+
+		void Model::setUniformsFunction(std::function<void(Ptr<Shader> const &)> const & uniformsFunction_, bool transformOnly)
 		{
 			uniformsFunction = uniformsFunction_;
+			uniformsFunctionTransformOnly = transformOnly;
+			scene->onModelBatchChanged();
 		}
 
-		void Model::render(std::function<void(Ptr<Shader> const &)> const & stageUniformsFunction, std::function<void(Ptr<Shader> const &)> const & sceneUniformsFunction, bool flipY) const
+		void Model::record(CommandList & commands, std::function<void(Ptr<Shader> const &)> const & stageUniformsFunction, std::function<void(Ptr<Shader> const &)> const & sceneUniformsFunction, bool flipY) const
 		{
-			if (!shader || !mesh)
+			if (!activate(commands, stageUniformsFunction, sceneUniformsFunction, flipY))
 			{
 				return;
 			}
-			bool newShader = shader->activate();
+			if (isInstanced())
+			{
+				commands.drawInstances(mesh.raw(), &instanceTransform, 1, shader->getInstanceTransformLocation());
+			}
+			else
+			{
+				commands.draw(mesh.raw());
+			}
+		}
+
+		void Model::recordInstances(CommandList & commands, std::function<void(Ptr<Shader> const &)> const & stageUniformsFunction, std::function<void(Ptr<Shader> const &)> const & sceneUniformsFunction, bool flipY, Matrix44f const * transforms, unsigned int numTransforms) const
+		{
+			if (numTransforms == 0 || !activate(commands, stageUniformsFunction, sceneUniformsFunction, flipY))
+			{
+				return;
+			}
+			commands.drawInstances(mesh.raw(), transforms, numTransforms, shader->getInstanceTransformLocation());
+		}
+
+		bool Model::canBatchWith(Model const & other) const
+		{
+			if (!isInstanced() || !mesh || !(shader == other.shader) || !(mesh == other.mesh) || images.size() != other.images.size())
+			{
+				return false;
+			}
+			if ((uniformsFunction && !uniformsFunctionTransformOnly) || (other.uniformsFunction && !other.uniformsFunctionTransformOnly))
+			{
+				return false; // Only the first model's uniforms function is called for the batch.
+			}
+			for (unsigned int slot = 0; slot < images.size(); slot++)
+			{
+				if (!(images[slot] == other.images[slot]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		uint64_t Model::getSortKey() const
+		{
+			return sortKey;
+		}
+
+		unsigned int Model::getSceneIndex() const
+		{
+			return sceneIndex;
+		}
+
+		void Model::setSceneIndex(unsigned int sceneIndex_)
+		{
+			sceneIndex = sceneIndex_;
+		}
+
+		bool Model::activate(CommandList & commands, std::function<void(Ptr<Shader> const &)> const & stageUniformsFunction, std::function<void(Ptr<Shader> const &)> const & sceneUniformsFunction, bool flipY) const
+		{
+			if (!shader || !mesh)
+			{
+				return false;
+			}
+			// The uniform values set by the functions are recorded into the command list, since it is recording on this thread.
+			bool newShader = commands.useShader(shader.raw());
 			if (newShader)
 			{
 				if (stageUniformsFunction)
@@ -81,7 +196,7 @@ namespace ve
 				{
 					sceneUniformsFunction(shader);
 				}
-				shader->setUniformValue<float>("flipY", flipY ? -1.0f : 1.0f);
+				shader->setUniformValue<float>(flipYUniformId, flipY ? -1.0f : 1.0f);
 			}
 			if (uniformsFunction)
 			{
@@ -91,71 +206,40 @@ namespace ve
 			{
 				if (images[slot].isValid())
 				{
-					images[slot]->activate(slot);
+					commands.bindImage(slot, images[slot].raw());
 				}
 			}
-			Image::deactivateRest((unsigned int)images.size());
-			mesh->render();
+			commands.unbindImages((unsigned int)images.size());
+			return true;
 		}
 
-		bool Model::operator < (Model const & model) const
+		void Model::updateSortKey()
 		{
-			if (!shader && model.shader)
-			{
-				return true;
-			}
-			if (!shader || !model.shader)
-			{
-				return false;
-			}
-			if (shader->getBlending() == Shader::Blending::NONE && model.shader->getBlending() != Shader::Blending::NONE)
-			{
-				return true;
-			}
-			if (shader->getBlending() != Shader::Blending::NONE && model.shader->getBlending() == Shader::Blending::NONE)
+			// The key is packed so that an unsigned compare gives the render order. The GL ids are small numbers
+			// unique among live objects. They are masked to fit, so a collision only costs a redundant state change.
+			uint64_t newSortKey = 0;
+			if (shader.isValid())
 			{
-				return false;
-			}
-			else if (shader->getBlending() == Shader::Blending::NONE)
-			{
-				if (shader != model.shader)
+				uint64_t shaderBits = shader->getGLProgram() & 0x7fff;
+				uint64_t image0Bits = (images.size() > 0 && images[0].isValid()) ? (images[0]->getGLId() & 0xffff) : 0;
+				if (shader->getBlending() == Shader::Blending::NONE)
 				{
-					return shader < model.shader;
+					// Opaque: | 0 | shader (15) | image 0 (16) | image 1 (12) | mesh (20) |
+					uint64_t image1Bits = (images.size() > 1 && images[1].isValid()) ? (images[1]->getGLId() & 0xfff) : 0;
+					uint64_t meshBits = mesh.isValid() ? (mesh->getGLVertexArrayObject() & 0xfffff) : 0;
+					newSortKey = (shaderBits << 48) | (image0Bits << 32) | (image1Bits << 20) | meshBits;
 				}
-				for (unsigned int slot = 0; slot < images.size() && slot < model.images.size(); slot++)
+				else
 				{
-					if (slot == images.size() && slot < model.images.size())
-					{
-						return true;
-					}
-					if (slot == model.images.size())
-					{
-						return false;
-					}
-					if (images[slot] != model.images[slot])
-					{
-						return images[slot] < model.images[slot];
-					}
+					// Blended, after all opaque models and by increasing depth: | 1 | depth (32) | shader (15) | image 0 (16) |
+					newSortKey = ((uint64_t)1 << 63) | ((uint64_t)getSortableBits(depth) << 31) | (shaderBits << 16) | image0Bits;
 				}
-				return mesh < model.mesh;
 			}
-			else if (getDepth() < model.getDepth()) // some blending, sort by depth
+			if (newSortKey != sortKey)
 			{
-				return true;
+				sortKey = newSortKey;
+				scene->onModelSortKeyChanged();
 			}
-			else if (getDepth() > model.getDepth())
-			{
-				return false;
-			}
-			else // just do the pointer to guarantee an explicit ordering.
-			{
-				return this < &model;
-			}
-		}
-
-		bool operator < (Ptr<Model> const & lhs, Ptr<Model> const & rhs)
-		{
-			return *lhs < *rhs;
 		}
 	}
 }
\ No newline at end of file
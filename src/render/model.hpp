@@ -1,22 +1,27 @@
 #pragma once
 
+#include "render/command_list.hpp"
 #include "render/mesh.hpp"
 #include "render/image.hpp"
 #include "render/shader.hpp"
 #include "util/ptr.hpp"
+#include "util/sphere.hpp"
 #include <functional>
 #include <unordered_map>
+#include <cstdint>
 
 namespace ve
 {
 	namespace render
 	{
+		class Scene;
+
 		// A model class contains all of the information needed to draw a single 'object' on the screen.
 		class Model
 		{
 		public:
-			// Default constructor.
-			Model();
+			// Constructor. Called by the scene that owns the model.
+			Model(Scene * scene);
 
 			// Returns the depth.
 			float getDepth() const;
@@ -42,23 +47,59 @@ namespace ve
 			// Sets the image used at the given slot.
 			void setImageAtSlot(Ptr<Image> const & image, unsigned int slot);
 
+			// Returns the bounding sphere in scene coordinates.
+			Sphere3f getBoundingSphere() const;
+
+			// Sets the bounding sphere in scene coordinates, used to skip the model when it is outside of the view. A negative radius, the default, means it is never skipped.
+			void setBoundingSphere(Sphere3f const & sphere);
+
+			// Returns the local-to-world transform used when the shader takes it per instance.
+			Matrix44f const & getInstanceTransform() const;
+
+			// Sets the local-to-world transform used when the shader takes it per instance. See Shader::getInstanceTransformLocation().
+			void setInstanceTransform(Matrix44f const & transform);
+
+			// Returns true if the shader takes the transform per instance, so that the model can be drawn in a batch.
+			bool isInstanced() const;
+
 			// Sets the function to be called that sets any model-specific uniforms.
-			void setUniformsFunction(std::function<void(Ptr<Shader> const &)> const & uniformsFunction);
+			// A batch is drawn with only the uniforms function of its first model, so a model with a uniforms function is only batched if transformOnly is true.
+			// Set it only if the function sets nothing but the transform, which the instance transform replaces when the shader takes it per instance.
+			void setUniformsFunction(std::function<void(Ptr<Shader> const &)> const & uniformsFunction, bool transformOnly = false);
+
+			// Internal to renderer. Records the rendering of the model into the command list. It may be called on a worker thread.
+			void record(CommandList & commands, std::function<void(Ptr<Shader> const &)> const & stageUniformsFunction, std::function<void(Ptr<Shader> const &)> const & sceneUniformsFunction, bool flipY) const;
 
-			// Renders the model.
-			void render(std::function<void(Ptr<Shader> const &)> const & stageUniformsFunction, std::function<void(Ptr<Shader> const &)> const & sceneUniformsFunction, bool flipY) const;
+			// Internal to renderer. Records the rendering of the mesh once per transform with the state of this model, in a single draw. Only this model's uniforms function is called.
+			void recordInstances(CommandList & commands, std::function<void(Ptr<Shader> const &)> const & stageUniformsFunction, std::function<void(Ptr<Shader> const &)> const & sceneUniformsFunction, bool flipY, Matrix44f const * transforms, unsigned int numTransforms) const;
 
-			// Returns true if this model sorts less than the other model.
-			bool operator < (Model const & model) const;
+			// Internal to renderer. Returns true if the model can be drawn in the same instanced batch as the other model. Models with uniforms functions that set more than the transform can't.
+			bool canBatchWith(Model const & other) const;
+
+			// Internal to renderer. Returns the key used by the scene to sort models. Models with smaller keys are rendered first.
+			uint64_t getSortKey() const;
+
+			// Internal to renderer. Returns the index of the model in the scene's model list.
+			unsigned int getSceneIndex() const;
+
+			// Internal to renderer. Sets the index of the model in the scene's model list.
+			void setSceneIndex(unsigned int sceneIndex);
 
 		private:
+			bool activate(CommandList & commands, std::function<void(Ptr<Shader> const &)> const & stageUniformsFunction, std::function<void(Ptr<Shader> const &)> const & sceneUniformsFunction, bool flipY) const;
+
+			void updateSortKey();
+
+			Scene * scene;
+			unsigned int sceneIndex;
+			uint64_t sortKey;
 			float depth;
 			std::vector<Ptr<Image>> images;
 			Ptr<Shader> shader;
 			Ptr<Mesh> mesh;
+			Matrix44f instanceTransform;
 			std::function<void(Ptr<Shader> const &)> uniformsFunction;
+			bool uniformsFunctionTransformOnly; // True if the uniforms function only sets the transform, so the model can still be batched.
 		};
-
-		bool operator < (Ptr<Model> const & lhs, Ptr<Model> const & rhs);
 	}
 }
\ No newline at end of file
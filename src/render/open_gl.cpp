@@ -710,8 +710,15 @@ namespace ve
 	{
 		std::stack<Recti> scissorStack;
 
+		void glInitializeNull(); // In open_gl_null.cpp.
+
 		void glInitialize()
 		{
+			if (glIsNullBackend())
+			{
+				glInitializeNull();
+				return;
+			}
 			glCullFace = (PFNGLCULLFACEPROC)SDL_GL_GetProcAddress("glCullFace");
 			glFrontFace = (PFNGLFRONTFACEPROC)SDL_GL_GetProcAddress("glFrontFace");
 			glHint = (PFNGLHINTPROC)SDL_GL_GetProcAddress("glHint");
@@ -2,7 +2,10 @@
 
 #define NOMINMAX
 #include "glcorearb.h"
+#include <cstdint>
+#include <map>
 #include <string>
+#include <vector>
 
 namespace ve
 {
@@ -17,6 +20,38 @@ namespace ve
 		void glScissorPush(GLint x, GLint y, GLsizei width, GLsizei height);
 
 		void glScissorPop();
+
+		// What the null backend has recorded. The counts are since the last reset and the bound state is current.
+		struct GLNullRecord
+		{
+			std::map<std::string, unsigned int> callCounts; // The number of calls of each GL function that was called.
+			unsigned int numCalls = 0;
+			unsigned int numDrawCalls = 0;
+			uint64_t numBufferBytes = 0;
+			uint64_t numTextureBytes = 0;
+			uint64_t numUniformBytes = 0;
+			unsigned int program = 0;
+			unsigned int vertexArray = 0;
+			unsigned int arrayBuffer = 0;
+			unsigned int elementArrayBuffer = 0;
+			unsigned int uniformBuffer = 0;
+			unsigned int framebuffer = 0;
+			unsigned int activeTexture = 0;
+			std::vector<unsigned int> textures; // The 2D texture bound to each texture unit.
+		};
+
+		// Sets whether glInitialize uses the null backend, where every GL function is a stub and no context is needed. Call before any window is created.
+		// Linked programs report the uniforms, uniform blocks, and vertex attributes declared in their shaders' sources, all as active, so that setting uniforms is exercised.
+		void glUseNullBackend(bool nullBackend);
+
+		// Returns true if the null backend is used.
+		bool glIsNullBackend();
+
+		// Returns what the null backend has recorded.
+		GLNullRecord glGetNullRecord();
+
+		// Resets the call counts and byte counts of the null backend, but not the bound state.
+		void glResetNullRecord();
 	}
 }
 
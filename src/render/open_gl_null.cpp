@@ -0,0 +1,2053 @@
+#include "render/open_gl.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+// The null backend. Every GL function is a stub that counts its calls, and the functions that the renderer depends on for ids, queries,
+// bindings, uploads and draws also record what they were given, so that the CPU side of rendering can be measured without a GL context.
+
+namespace ve
+{
+	namespace render
+	{
+		// The ids of the GL functions, in the order of glInitialize.
+		enum FunctionId
+		{
+			glCullFaceId,
+			glFrontFaceId,
+			glHintId,
+			glLineWidthId,
+			glPointSizeId,
+			glPolygonModeId,
+			glScissorId,
+			glTexParameterfId,
+			glTexParameterfvId,
+			glTexParameteriId,
+			glTexParameterivId,
+			glTexImage1DId,
+			glTexImage2DId,
+			glDrawBufferId,
+			glClearId,
+			glClearColorId,
+			glClearStencilId,
+			glClearDepthId,
+			glStencilMaskId,
+			glColorMaskId,
+			glDepthMaskId,
+			glDisableId,
+			glEnableId,
+			glFinishId,
+			glFlushId,
+			glBlendFuncId,
+			glLogicOpId,
+			glStencilFuncId,
+			glStencilOpId,
+			glDepthFuncId,
+			glPixelStorefId,
+			glPixelStoreiId,
+			glReadBufferId,
+			glReadPixelsId,
+			glGetBooleanvId,
+			glGetDoublevId,
+			glGetErrorId,
+			glGetFloatvId,
+			glGetIntegervId,
+			glGetStringId,
+			glGetTexImageId,
+			glGetTexParameterfvId,
+			glGetTexParameterivId,
+			glGetTexLevelParameterfvId,
+			glGetTexLevelParameterivId,
+			glIsEnabledId,
+			glDepthRangeId,
+			glViewportId,
+			glDrawArraysId,
+			glDrawElementsId,
+			glGetPointervId,
+			glPolygonOffsetId,
+			glCopyTexImage1DId,
+			glCopyTexImage2DId,
+			glCopyTexSubImage1DId,
+			glCopyTexSubImage2DId,
+			glTexSubImage1DId,
+			glTexSubImage2DId,
+			glBindTextureId,
+			glDeleteTexturesId,
+			glGenTexturesId,
+			glIsTextureId,
+			glDrawRangeElementsId,
+			glTexImage3DId,
+			glTexSubImage3DId,
+			glCopyTexSubImage3DId,
+			glActiveTextureId,
+			glSampleCoverageId,
+			glCompressedTexImage3DId,
+			glCompressedTexImage2DId,
+			glCompressedTexImage1DId,
+			glCompressedTexSubImage3DId,
+			glCompressedTexSubImage2DId,
+			glCompressedTexSubImage1DId,
+			glGetCompressedTexImageId,
+			glBlendFuncSeparateId,
+			glMultiDrawArraysId,
+			glMultiDrawElementsId,
+			glPointParameterfId,
+			glPointParameterfvId,
+			glPointParameteriId,
+			glPointParameterivId,
+			glBlendColorId,
+			glBlendEquationId,
+			glGenQueriesId,
+			glDeleteQueriesId,
+			glIsQueryId,
+			glBeginQueryId,
+			glEndQueryId,
+			glGetQueryivId,
+			glGetQueryObjectivId,
+			glGetQueryObjectuivId,
+			glBindBufferId,
+			glDeleteBuffersId,
+			glGenBuffersId,
+			glIsBufferId,
+			glBufferDataId,
+			glBufferSubDataId,
+			glGetBufferSubDataId,
+			glMapBufferId,
+			glUnmapBufferId,
+			glGetBufferParameterivId,
+			glGetBufferPointervId,
+			glBlendEquationSeparateId,
+			glDrawBuffersId,
+			glStencilOpSeparateId,
+			glStencilFuncSeparateId,
+			glStencilMaskSeparateId,
+			glAttachShaderId,
+			glBindAttribLocationId,
+			glCompileShaderId,
+			glCreateProgramId,
+			glCreateShaderId,
+			glDeleteProgramId,
+			glDeleteShaderId,
+			glDetachShaderId,
+			glDisableVertexAttribArrayId,
+			glEnableVertexAttribArrayId,
+			glGetActiveAttribId,
+			glGetActiveUniformId,
+			glGetAttachedShadersId,
+			glGetAttribLocationId,
+			glGetProgramivId,
+			glGetProgramInfoLogId,
+			glGetShaderivId,
+			glGetShaderInfoLogId,
+			glGetShaderSourceId,
+			glGetUniformLocationId,
+			glGetUniformfvId,
+			glGetUniformivId,
+			glGetVertexAttribdvId,
+			glGetVertexAttribfvId,
+			glGetVertexAttribivId,
+			glGetVertexAttribPointervId,
+			glIsProgramId,
+			glIsShaderId,
+			glLinkProgramId,
+			glShaderSourceId,
+			glUseProgramId,
+			glUniform1fId,
+			glUniform2fId,
+			glUniform3fId,
+			glUniform4fId,
+			glUniform1iId,
+			glUniform2iId,
+			glUniform3iId,
+			glUniform4iId,
+			glUniform1fvId,
+			glUniform2fvId,
+			glUniform3fvId,
+			glUniform4fvId,
+			glUniform1ivId,
+			glUniform2ivId,
+			glUniform3ivId,
+			glUniform4ivId,
+			glUniformMatrix2fvId,
+			glUniformMatrix3fvId,
+			glUniformMatrix4fvId,
+			glValidateProgramId,
+			glVertexAttrib1dId,
+			glVertexAttrib1dvId,
+			glVertexAttrib1fId,
+			glVertexAttrib1fvId,
+			glVertexAttrib1sId,
+			glVertexAttrib1svId,
+			glVertexAttrib2dId,
+			glVertexAttrib2dvId,
+			glVertexAttrib2fId,
+			glVertexAttrib2fvId,
+			glVertexAttrib2sId,
+			glVertexAttrib2svId,
+			glVertexAttrib3dId,
+			glVertexAttrib3dvId,
+			glVertexAttrib3fId,
+			glVertexAttrib3fvId,
+			glVertexAttrib3sId,
+			glVertexAttrib3svId,
+			glVertexAttrib4NbvId,
+			glVertexAttrib4NivId,
+			glVertexAttrib4NsvId,
+			glVertexAttrib4NubId,
+			glVertexAttrib4NubvId,
+			glVertexAttrib4NuivId,
+			glVertexAttrib4NusvId,
+			glVertexAttrib4bvId,
+			glVertexAttrib4dId,
+			glVertexAttrib4dvId,
+			glVertexAttrib4fId,
+			glVertexAttrib4fvId,
+			glVertexAttrib4ivId,
+			glVertexAttrib4sId,
+			glVertexAttrib4svId,
+			glVertexAttrib4ubvId,
+			glVertexAttrib4uivId,
+			glVertexAttrib4usvId,
+			glVertexAttribPointerId,
+			glUniformMatrix2x3fvId,
+			glUniformMatrix3x2fvId,
+			glUniformMatrix2x4fvId,
+			glUniformMatrix4x2fvId,
+			glUniformMatrix3x4fvId,
+			glUniformMatrix4x3fvId,
+			glColorMaskiId,
+			glGetBooleani_vId,
+			glGetIntegeri_vId,
+			glEnableiId,
+			glDisableiId,
+			glIsEnablediId,
+			glBeginTransformFeedbackId,
+			glEndTransformFeedbackId,
+			glBindBufferRangeId,
+			glBindBufferBaseId,
+			glTransformFeedbackVaryingsId,
+			glGetTransformFeedbackVaryingId,
+			glClampColorId,
+			glBeginConditionalRenderId,
+			glEndConditionalRenderId,
+			glVertexAttribIPointerId,
+			glGetVertexAttribIivId,
+			glGetVertexAttribIuivId,
+			glVertexAttribI1iId,
+			glVertexAttribI2iId,
+			glVertexAttribI3iId,
+			glVertexAttribI4iId,
+			glVertexAttribI1uiId,
+			glVertexAttribI2uiId,
+			glVertexAttribI3uiId,
+			glVertexAttribI4uiId,
+			glVertexAttribI1ivId,
+			glVertexAttribI2ivId,
+			glVertexAttribI3ivId,
+			glVertexAttribI4ivId,
+			glVertexAttribI1uivId,
+			glVertexAttribI2uivId,
+			glVertexAttribI3uivId,
+			glVertexAttribI4uivId,
+			glVertexAttribI4bvId,
+			glVertexAttribI4svId,
+			glVertexAttribI4ubvId,
+			glVertexAttribI4usvId,
+			glGetUniformuivId,
+			glBindFragDataLocationId,
+			glGetFragDataLocationId,
+			glUniform1uiId,
+			glUniform2uiId,
+			glUniform3uiId,
+			glUniform4uiId,
+			glUniform1uivId,
+			glUniform2uivId,
+			glUniform3uivId,
+			glUniform4uivId,
+			glTexParameterIivId,
+			glTexParameterIuivId,
+			glGetTexParameterIivId,
+			glGetTexParameterIuivId,
+			glClearBufferivId,
+			glClearBufferuivId,
+			glClearBufferfvId,
+			glClearBufferfiId,
+			glGetStringiId,
+			glIsRenderbufferId,
+			glBindRenderbufferId,
+			glDeleteRenderbuffersId,
+			glGenRenderbuffersId,
+			glRenderbufferStorageId,
+			glGetRenderbufferParameterivId,
+			glIsFramebufferId,
+			glBindFramebufferId,
+			glDeleteFramebuffersId,
+			glGenFramebuffersId,
+			glCheckFramebufferStatusId,
+			glFramebufferTexture1DId,
+			glFramebufferTexture2DId,
+			glFramebufferTexture3DId,
+			glFramebufferRenderbufferId,
+			glGetFramebufferAttachmentParameterivId,
+			glGenerateMipmapId,
+			glBlitFramebufferId,
+			glRenderbufferStorageMultisampleId,
+			glFramebufferTextureLayerId,
+			glMapBufferRangeId,
+			glFlushMappedBufferRangeId,
+			glBindVertexArrayId,
+			glDeleteVertexArraysId,
+			glGenVertexArraysId,
+			glIsVertexArrayId,
+			glDrawArraysInstancedId,
+			glDrawElementsInstancedId,
+			glTexBufferId,
+			glPrimitiveRestartIndexId,
+			glCopyBufferSubDataId,
+			glGetUniformIndicesId,
+			glGetActiveUniformsivId,
+			glGetActiveUniformNameId,
+			glGetUniformBlockIndexId,
+			glGetActiveUniformBlockivId,
+			glGetActiveUniformBlockNameId,
+			glUniformBlockBindingId,
+			glDrawElementsBaseVertexId,
+			glDrawRangeElementsBaseVertexId,
+			glDrawElementsInstancedBaseVertexId,
+			glMultiDrawElementsBaseVertexId,
+			glProvokingVertexId,
+			glFenceSyncId,
+			glIsSyncId,
+			glDeleteSyncId,
+			glClientWaitSyncId,
+			glWaitSyncId,
+			glGetInteger64vId,
+			glGetSyncivId,
+			glGetInteger64i_vId,
+			glGetBufferParameteri64vId,
+			glFramebufferTextureId,
+			glTexImage2DMultisampleId,
+			glTexImage3DMultisampleId,
+			glGetMultisamplefvId,
+			glSampleMaskiId,
+			glBindFragDataLocationIndexedId,
+			glGetFragDataIndexId,
+			glGenSamplersId,
+			glDeleteSamplersId,
+			glIsSamplerId,
+			glBindSamplerId,
+			glSamplerParameteriId,
+			glSamplerParameterivId,
+			glSamplerParameterfId,
+			glSamplerParameterfvId,
+			glSamplerParameterIivId,
+			glSamplerParameterIuivId,
+			glGetSamplerParameterivId,
+			glGetSamplerParameterIivId,
+			glGetSamplerParameterfvId,
+			glGetSamplerParameterIuivId,
+			glQueryCounterId,
+			glGetQueryObjecti64vId,
+			glGetQueryObjectui64vId,
+			glVertexAttribDivisorId,
+			glVertexAttribP1uiId,
+			glVertexAttribP1uivId,
+			glVertexAttribP2uiId,
+			glVertexAttribP2uivId,
+			glVertexAttribP3uiId,
+			glVertexAttribP3uivId,
+			glVertexAttribP4uiId,
+			glVertexAttribP4uivId,
+			glMinSampleShadingId,
+			glBlendEquationiId,
+			glBlendEquationSeparateiId,
+			glBlendFunciId,
+			glBlendFuncSeparateiId,
+			glDrawArraysIndirectId,
+			glDrawElementsIndirectId,
+			glUniform1dId,
+			glUniform2dId,
+			glUniform3dId,
+			glUniform4dId,
+			glUniform1dvId,
+			glUniform2dvId,
+			glUniform3dvId,
+			glUniform4dvId,
+			glUniformMatrix2dvId,
+			glUniformMatrix3dvId,
+			glUniformMatrix4dvId,
+			glUniformMatrix2x3dvId,
+			glUniformMatrix2x4dvId,
+			glUniformMatrix3x2dvId,
+			glUniformMatrix3x4dvId,
+			glUniformMatrix4x2dvId,
+			glUniformMatrix4x3dvId,
+			glGetUniformdvId,
+			glGetSubroutineUniformLocationId,
+			glGetSubroutineIndexId,
+			glGetActiveSubroutineUniformivId,
+			glGetActiveSubroutineUniformNameId,
+			glGetActiveSubroutineNameId,
+			glUniformSubroutinesuivId,
+			glGetUniformSubroutineuivId,
+			glGetProgramStageivId,
+			glPatchParameteriId,
+			glPatchParameterfvId,
+			glBindTransformFeedbackId,
+			glDeleteTransformFeedbacksId,
+			glGenTransformFeedbacksId,
+			glIsTransformFeedbackId,
+			glPauseTransformFeedbackId,
+			glResumeTransformFeedbackId,
+			glDrawTransformFeedbackId,
+			glDrawTransformFeedbackStreamId,
+			glBeginQueryIndexedId,
+			glEndQueryIndexedId,
+			glGetQueryIndexedivId,
+			glReleaseShaderCompilerId,
+			glShaderBinaryId,
+			glGetShaderPrecisionFormatId,
+			glDepthRangefId,
+			glClearDepthfId,
+			glGetProgramBinaryId,
+			glProgramBinaryId,
+			glProgramParameteriId,
+			glUseProgramStagesId,
+			glActiveShaderProgramId,
+			glCreateShaderProgramvId,
+			glBindProgramPipelineId,
+			glDeleteProgramPipelinesId,
+			glGenProgramPipelinesId,
+			glIsProgramPipelineId,
+			glGetProgramPipelineivId,
+			glProgramUniform1iId,
+			glProgramUniform1ivId,
+			glProgramUniform1fId,
+			glProgramUniform1fvId,
+			glProgramUniform1dId,
+			glProgramUniform1dvId,
+			glProgramUniform1uiId,
+			glProgramUniform1uivId,
+			glProgramUniform2iId,
+			glProgramUniform2ivId,
+			glProgramUniform2fId,
+			glProgramUniform2fvId,
+			glProgramUniform2dId,
+			glProgramUniform2dvId,
+			glProgramUniform2uiId,
+			glProgramUniform2uivId,
+			glProgramUniform3iId,
+			glProgramUniform3ivId,
+			glProgramUniform3fId,
+			glProgramUniform3fvId,
+			glProgramUniform3dId,
+			glProgramUniform3dvId,
+			glProgramUniform3uiId,
+			glProgramUniform3uivId,
+			glProgramUniform4iId,
+			glProgramUniform4ivId,
+			glProgramUniform4fId,
+			glProgramUniform4fvId,
+			glProgramUniform4dId,
+			glProgramUniform4dvId,
+			glProgramUniform4uiId,
+			glProgramUniform4uivId,
+			glProgramUniformMatrix2fvId,
+			glProgramUniformMatrix3fvId,
+			glProgramUniformMatrix4fvId,
+			glProgramUniformMatrix2dvId,
+			glProgramUniformMatrix3dvId,
+			glProgramUniformMatrix4dvId,
+			glProgramUniformMatrix2x3fvId,
+			glProgramUniformMatrix3x2fvId,
+			glProgramUniformMatrix2x4fvId,
+			glProgramUniformMatrix4x2fvId,
+			glProgramUniformMatrix3x4fvId,
+			glProgramUniformMatrix4x3fvId,
+			glProgramUniformMatrix2x3dvId,
+			glProgramUniformMatrix3x2dvId,
+			glProgramUniformMatrix2x4dvId,
+			glProgramUniformMatrix4x2dvId,
+			glProgramUniformMatrix3x4dvId,
+			glProgramUniformMatrix4x3dvId,
+			glValidateProgramPipelineId,
+			glGetProgramPipelineInfoLogId,
+			glVertexAttribL1dId,
+			glVertexAttribL2dId,
+			glVertexAttribL3dId,
+			glVertexAttribL4dId,
+			glVertexAttribL1dvId,
+			glVertexAttribL2dvId,
+			glVertexAttribL3dvId,
+			glVertexAttribL4dvId,
+			glVertexAttribLPointerId,
+			glGetVertexAttribLdvId,
+			glViewportArrayvId,
+			glViewportIndexedfId,
+			glViewportIndexedfvId,
+			glScissorArrayvId,
+			glScissorIndexedId,
+			glScissorIndexedvId,
+			glDepthRangeArrayvId,
+			glDepthRangeIndexedId,
+			glGetFloati_vId,
+			glGetDoublei_vId,
+			glDrawArraysInstancedBaseInstanceId,
+			glDrawElementsInstancedBaseInstanceId,
+			glDrawElementsInstancedBaseVertexBaseInstanceId,
+			glGetformativId,
+			glGetActiveAtomicCounterBufferivId,
+			glBindImageTextureId,
+			glMemoryBarrierId,
+			glTexStorage1DId,
+			glTexStorage2DId,
+			glTexStorage3DId,
+			glDrawTransformFeedbackInstancedId,
+			glDrawTransformFeedbackStreamInstancedId,
+			glClearBufferDataId,
+			glClearBufferSubDataId,
+			glDispatchComputeId,
+			glDispatchComputeIndirectId,
+			glCopyImageSubDataId,
+			glFramebufferParameteriId,
+			glGetFramebufferParameterivId,
+			glGetformati64vId,
+			glInvalidateTexSubImageId,
+			glInvalidateTexImageId,
+			glInvalidateBufferSubDataId,
+			glInvalidateBufferDataId,
+			glInvalidateFramebufferId,
+			glInvalidateSubFramebufferId,
+			glMultiDrawArraysIndirectId,
+			glMultiDrawElementsIndirectId,
+			glGetProgramInterfaceivId,
+			glGetProgramResourceIndexId,
+			glGetProgramResourceNameId,
+			glGetProgramResourceivId,
+			glGetProgramResourceLocationId,
+			glGetProgramResourceLocationIndexId,
+			glShaderStorageBlockBindingId,
+			glTexBufferRangeId,
+			glTexStorage2DMultisampleId,
+			glTexStorage3DMultisampleId,
+			glTextureViewId,
+			glBindVertexBufferId,
+			glVertexAttribFormatId,
+			glVertexAttribIFormatId,
+			glVertexAttribLFormatId,
+			glVertexAttribBindingId,
+			glVertexBindingDivisorId,
+			glDebugMessageControlId,
+			glDebugMessageInsertId,
+			glDebugMessageCallbackId,
+			glGetDebugMessageLogId,
+			glPushDebugGroupId,
+			glPopDebugGroupId,
+			glObjectLabelId,
+			glGetObjectLabelId,
+			glObjectPtrLabelId,
+			glGetObjectPtrLabelId,
+			glBufferStorageId,
+			glClearTexImageId,
+			glClearTexSubImageId,
+			glBindBuffersBaseId,
+			glBindBuffersRangeId,
+			glBindTexturesId,
+			glBindSamplersId,
+			glBindImageTexturesId,
+			glBindVertexBuffersId,
+			glClipControlId,
+			glCreateTransformFeedbacksId,
+			glTransformFeedbackBufferBaseId,
+			glTransformFeedbackBufferRangeId,
+			glGetTransformFeedbackivId,
+			glGetTransformFeedbacki_vId,
+			glGetTransformFeedbacki64_vId,
+			glCreateBuffersId,
+			glNamedBufferStorageId,
+			glNamedBufferDataId,
+			glNamedBufferSubDataId,
+			glCopyNamedBufferSubDataId,
+			glClearNamedBufferDataId,
+			glClearNamedBufferSubDataId,
+			glMapNamedBufferId,
+			glMapNamedBufferRangeId,
+			glUnmapNamedBufferId,
+			glFlushMappedNamedBufferRangeId,
+			glGetNamedBufferParameterivId,
+			glGetNamedBufferParameteri64vId,
+			glGetNamedBufferPointervId,
+			glGetNamedBufferSubDataId,
+			glCreateFramebuffersId,
+			glNamedFramebufferRenderbufferId,
+			glNamedFramebufferParameteriId,
+			glNamedFramebufferTextureId,
+			glNamedFramebufferTextureLayerId,
+			glNamedFramebufferDrawBufferId,
+			glNamedFramebufferDrawBuffersId,
+			glNamedFramebufferReadBufferId,
+			glInvalidateNamedFramebufferDataId,
+			glInvalidateNamedFramebufferSubDataId,
+			glClearNamedFramebufferivId,
+			glClearNamedFramebufferuivId,
+			glClearNamedFramebufferfvId,
+			glClearNamedFramebufferfiId,
+			glBlitNamedFramebufferId,
+			glCheckNamedFramebufferStatusId,
+			glGetNamedFramebufferParameterivId,
+			glGetNamedFramebufferAttachmentParameterivId,
+			glCreateRenderbuffersId,
+			glNamedRenderbufferStorageId,
+			glNamedRenderbufferStorageMultisampleId,
+			glGetNamedRenderbufferParameterivId,
+			glCreateTexturesId,
+			glTextureBufferId,
+			glTextureBufferRangeId,
+			glTextureStorage1DId,
+			glTextureStorage2DId,
+			glTextureStorage3DId,
+			glTextureStorage2DMultisampleId,
+			glTextureStorage3DMultisampleId,
+			glTextureSubImage1DId,
+			glTextureSubImage2DId,
+			glTextureSubImage3DId,
+			glCompressedTextureSubImage1DId,
+			glCompressedTextureSubImage2DId,
+			glCompressedTextureSubImage3DId,
+			glCopyTextureSubImage1DId,
+			glCopyTextureSubImage2DId,
+			glCopyTextureSubImage3DId,
+			glTextureParameterfId,
+			glTextureParameterfvId,
+			glTextureParameteriId,
+			glTextureParameterIivId,
+			glTextureParameterIuivId,
+			glTextureParameterivId,
+			glGenerateTextureMipmapId,
+			glBindTextureUnitId,
+			glGetTextureImageId,
+			glGetCompressedTextureImageId,
+			glGetTextureLevelParameterfvId,
+			glGetTextureLevelParameterivId,
+			glGetTextureParameterfvId,
+			glGetTextureParameterIivId,
+			glGetTextureParameterIuivId,
+			glGetTextureParameterivId,
+			glCreateVertexArraysId,
+			glDisableVertexArrayAttribId,
+			glEnableVertexArrayAttribId,
+			glVertexArrayElementBufferId,
+			glVertexArrayVertexBufferId,
+			glVertexArrayVertexBuffersId,
+			glVertexArrayAttribBindingId,
+			glVertexArrayAttribFormatId,
+			glVertexArrayAttribIFormatId,
+			glVertexArrayAttribLFormatId,
+			glVertexArrayBindingDivisorId,
+			glGetVertexArrayivId,
+			glGetVertexArrayIndexedivId,
+			glGetVertexArrayIndexed64ivId,
+			glCreateSamplersId,
+			glCreateProgramPipelinesId,
+			glCreateQueriesId,
+			glGetQueryBufferObjecti64vId,
+			glGetQueryBufferObjectivId,
+			glGetQueryBufferObjectui64vId,
+			glGetQueryBufferObjectuivId,
+			glMemoryBarrierByRegionId,
+			glGetTextureSubImageId,
+			glGetCompressedTextureSubImageId,
+			glGetGraphicsResetStatusId,
+			glGetnCompressedTexImageId,
+			glGetnTexImageId,
+			glGetnUniformdvId,
+			glGetnUniformfvId,
+			glGetnUniformivId,
+			glGetnUniformuivId,
+			glReadnPixelsId,
+			glTextureBarrierId,
+			glGetTextureHandleARBId,
+			glGetTextureSamplerHandleARBId,
+			glMakeTextureHandleResidentARBId,
+			glMakeTextureHandleNonResidentARBId,
+			glGetImageHandleARBId,
+			glMakeImageHandleResidentARBId,
+			glMakeImageHandleNonResidentARBId,
+			glUniformHandleui64ARBId,
+			glUniformHandleui64vARBId,
+			glProgramUniformHandleui64ARBId,
+			glProgramUniformHandleui64vARBId,
+			glIsTextureHandleResidentARBId,
+			glIsImageHandleResidentARBId,
+			glVertexAttribL1ui64ARBId,
+			glVertexAttribL1ui64vARBId,
+			glGetVertexAttribLui64vARBId,
+			glCreateSyncFromCLeventARBId,
+			glDispatchComputeGroupSizeARBId,
+			glDebugMessageControlARBId,
+			glDebugMessageInsertARBId,
+			glDebugMessageCallbackARBId,
+			glGetDebugMessageLogARBId,
+			glBlendEquationiARBId,
+			glBlendEquationSeparateiARBId,
+			glBlendFunciARBId,
+			glBlendFuncSeparateiARBId,
+			glMultiDrawArraysIndirectCountARBId,
+			glMultiDrawElementsIndirectCountARBId,
+			glGetGraphicsResetStatusARBId,
+			glGetnTexImageARBId,
+			glReadnPixelsARBId,
+			glGetnCompressedTexImageARBId,
+			glGetnUniformfvARBId,
+			glGetnUniformivARBId,
+			glGetnUniformuivARBId,
+			glGetnUniformdvARBId,
+			glMinSampleShadingARBId,
+			glNamedStringARBId,
+			glDeleteNamedStringARBId,
+			glCompileShaderIncludeARBId,
+			glIsNamedStringARBId,
+			glGetNamedStringARBId,
+			glGetNamedStringivARBId,
+			glBufferPageCommitmentARBId,
+			glNamedBufferPageCommitmentEXTId,
+			glNamedBufferPageCommitmentARBId,
+			glTexPageCommitmentARBId,
+			numFunctionIds
+		};
+
+		bool nullBackend = false;
+		char const * functionNames[numFunctionIds];
+		unsigned int callCounts[numFunctionIds];
+		GLNullRecord record;
+		unsigned int nextObjectId = 1; // Ids given out by the glGen and glCreate functions, shared by all object types.
+
+		// A uniform or vertex attribute declared in the source of a shader.
+		struct NullVariable
+		{
+			std::string name;
+			GLenum type;
+			GLint size; // The number of elements if it is an array, otherwise 1.
+			bool isArray; // Arrays are reported with "[0]" after the name, as GL does.
+			GLint location;
+		};
+
+		// A shader, with its source kept until it is linked.
+		struct NullShader
+		{
+			GLenum type;
+			std::string source;
+		};
+
+		// A program, with what its shaders declare filled in when it is linked.
+		struct NullProgram
+		{
+			std::vector<GLuint> shaders;
+			std::vector<NullVariable> uniforms; // The uniforms outside of blocks.
+			std::vector<std::string> uniformBlocks;
+			std::vector<NullVariable> attributes;
+		};
+
+		std::map<GLuint, NullShader> shaders;
+		std::map<GLuint, NullProgram> programs;
+
+		// Counts a call of the function.
+		void countCall(FunctionId id)
+		{
+			callCounts[id]++;
+			record.numCalls++;
+		}
+
+		// The stub of a GL function that only counts its calls and returns zero.
+		template <typename Function, FunctionId id> struct NullFunction;
+
+		template <typename Result, typename ... Args, FunctionId id>
+		struct NullFunction<Result (APIENTRYP)(Args ...), id>
+		{
+			static Result APIENTRY call(Args ...)
+			{
+				countCall(id);
+				return Result();
+			}
+		};
+
+		// Returns the bytes per pixel of the pixel format and type, for counting uploaded bytes.
+		unsigned int getBytesPerPixel(GLenum format, GLenum type)
+		{
+			unsigned int numComponents = 4;
+			switch (format)
+			{
+				case GL_RED: case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX: numComponents = 1; break;
+				case GL_RG: numComponents = 2; break;
+				case GL_RGB: case GL_BGR: numComponents = 3; break;
+			}
+			switch (type)
+			{
+				case GL_UNSIGNED_BYTE: case GL_BYTE: return numComponents;
+				case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: return numComponents * 2;
+				default: return numComponents * 4;
+			}
+		}
+
+		// Fills the array with new object ids.
+		void generateIds(GLsizei n, GLuint * ids)
+		{
+			for (GLsizei i = 0; i < n; i++)
+			{
+				ids[i] = nextObjectId++;
+			}
+		}
+
+		void APIENTRY nullGenBuffers(GLsizei n, GLuint * buffers) { countCall(glGenBuffersId); generateIds(n, buffers); }
+		void APIENTRY nullGenTextures(GLsizei n, GLuint * textures) { countCall(glGenTexturesId); generateIds(n, textures); }
+		void APIENTRY nullGenVertexArrays(GLsizei n, GLuint * arrays) { countCall(glGenVertexArraysId); generateIds(n, arrays); }
+		void APIENTRY nullGenFramebuffers(GLsizei n, GLuint * framebuffers) { countCall(glGenFramebuffersId); generateIds(n, framebuffers); }
+		void APIENTRY nullGenRenderbuffers(GLsizei n, GLuint * renderbuffers) { countCall(glGenRenderbuffersId); generateIds(n, renderbuffers); }
+		// Returns the GL type of a GLSL type, or 0 if it is not a basic type, such as a struct.
+		GLenum getGLType(std::string const & glslType)
+		{
+			static std::map<std::string, GLenum> const types = {
+				{"bool", GL_BOOL}, {"int", GL_INT}, {"uint", GL_UNSIGNED_INT}, {"float", GL_FLOAT},
+				{"ivec2", GL_INT_VEC2}, {"ivec3", GL_INT_VEC3}, {"ivec4", GL_INT_VEC4},
+				{"vec2", GL_FLOAT_VEC2}, {"vec3", GL_FLOAT_VEC3}, {"vec4", GL_FLOAT_VEC4},
+				{"mat2", GL_FLOAT_MAT2}, {"mat3", GL_FLOAT_MAT3}, {"mat4", GL_FLOAT_MAT4},
+				{"sampler2D", GL_SAMPLER_2D}, {"sampler3D", GL_SAMPLER_3D}, {"samplerCube", GL_SAMPLER_CUBE}};
+			auto it = types.find(glslType);
+			return (it != types.end()) ? it->second : 0;
+		}
+
+		// Returns the number of attribute locations that a vertex attribute of the type takes.
+		GLint getNumAttributeLocations(GLenum type)
+		{
+			switch (type)
+			{
+				case GL_FLOAT_MAT2: return 2;
+				case GL_FLOAT_MAT3: return 3;
+				case GL_FLOAT_MAT4: return 4;
+				default: return 1;
+			}
+		}
+
+		// Splits GLSL source into identifiers, numbers, and single characters, leaving out whitespace, comments, and preprocessor lines.
+		std::vector<std::string> tokenize(std::string const & source)
+		{
+			std::vector<std::string> tokens;
+			size_t i = 0;
+			while (i < source.size())
+			{
+				char c = source[i];
+				if (c == '#' || source.compare(i, 2, "//") == 0)
+				{
+					i = std::min(source.find('\n', i), source.size());
+				}
+				else if (source.compare(i, 2, "/*") == 0)
+				{
+					i = std::min(source.find("*/", i + 2), source.size() - 2) + 2;
+				}
+				else if (std::isalnum((unsigned char)c) || c == '_')
+				{
+					size_t start = i;
+					while (i < source.size() && (std::isalnum((unsigned char)source[i]) || source[i] == '_'))
+					{
+						i++;
+					}
+					tokens.push_back(source.substr(start, i - start));
+				}
+				else
+				{
+					if (!std::isspace((unsigned char)c))
+					{
+						tokens.push_back(std::string(1, c));
+					}
+					i++;
+				}
+			}
+			return tokens;
+		}
+
+		// Reads the names of a declaration after its type, up to the semicolon, and adds them to the variables if they are new. Returns the index of the semicolon.
+		size_t parseNames(std::vector<std::string> const & tokens, size_t i, GLenum type, GLint location, std::vector<NullVariable> & variables)
+		{
+			while (i < tokens.size() && tokens[i] != ";")
+			{
+				NullVariable variable {tokens[i], type, 1, false, location};
+				i++;
+				if (i < tokens.size() && tokens[i] == "[")
+				{
+					variable.isArray = true;
+					if (i + 1 < tokens.size() && std::isdigit((unsigned char)tokens[i + 1][0]))
+					{
+						variable.size = std::max(std::atoi(tokens[i + 1].c_str()), 1);
+					}
+				}
+				// Skip the array size and any initializer.
+				while (i < tokens.size() && tokens[i] != "," && tokens[i] != ";")
+				{
+					i++;
+				}
+				if (i < tokens.size() && tokens[i] == ",")
+				{
+					i++;
+				}
+				bool isNew = std::none_of(variables.begin(), variables.end(), [&variable](NullVariable const & other)
+				{
+					return other.name == variable.name;
+				});
+				if (type != 0 && isNew)
+				{
+					variables.push_back(variable);
+				}
+			}
+			return i;
+		}
+
+		// Adds the uniforms, uniform blocks and, for a vertex shader, the attributes that are declared at the top level of the shader to the program.
+		// Every one is reported as active, since nothing is compiled to find out which are used.
+		void parseDeclarations(NullShader const & shader, NullProgram & program)
+		{
+			std::vector<std::string> tokens = tokenize(shader.source);
+			GLint layoutLocation = -1; // From a layout qualifier, for the declaration that follows it.
+			unsigned int depth = 0; // Of braces and parentheses, so that function bodies and parameters are skipped.
+			for (size_t i = 0; i < tokens.size(); i++)
+			{
+				std::string const & token = tokens[i];
+				if (token == "{" || token == "(")
+				{
+					depth++;
+				}
+				else if (token == "}" || token == ")")
+				{
+					depth = (depth > 0) ? depth - 1 : 0;
+				}
+				else if (depth > 0)
+				{
+					continue;
+				}
+				else if (token == ";")
+				{
+					layoutLocation = -1;
+				}
+				else if (token == "layout")
+				{
+					for (i++; i < tokens.size() && tokens[i] != ")"; i++)
+					{
+						if (tokens[i] == "location" && i + 2 < tokens.size() && tokens[i + 1] == "=")
+						{
+							layoutLocation = std::atoi(tokens[i + 2].c_str());
+						}
+					}
+				}
+				else if (token == "uniform" || ((token == "in" || token == "attribute") && shader.type == GL_VERTEX_SHADER))
+				{
+					size_t j = i + 1;
+					while (j < tokens.size() && (tokens[j] == "lowp" || tokens[j] == "mediump" || tokens[j] == "highp"))
+					{
+						j++;
+					}
+					if (j + 1 >= tokens.size())
+					{
+						break;
+					}
+					if (tokens[j + 1] == "{")
+					{
+						if (token == "uniform" && std::find(program.uniformBlocks.begin(), program.uniformBlocks.end(), tokens[j]) == program.uniformBlocks.end())
+						{
+							program.uniformBlocks.push_back(tokens[j]);
+						}
+						i = j; // The members are skipped as the block's depth.
+					}
+					else
+					{
+						i = parseNames(tokens, j + 1, getGLType(tokens[j]), layoutLocation, token == "uniform" ? program.uniforms : program.attributes) - 1;
+					}
+				}
+			}
+		}
+
+		// Copies the name into a GL name buffer, as much as fits with the terminating null.
+		void copyName(std::string const & name, GLsizei bufSize, GLsizei * length, GLchar * buffer)
+		{
+			GLsizei nameLength = (bufSize > 0) ? std::min((GLsizei)name.size(), bufSize - 1) : 0;
+			if (bufSize > 0)
+			{
+				std::memcpy(buffer, name.c_str(), nameLength);
+				buffer[nameLength] = 0;
+			}
+			if (length != nullptr)
+			{
+				*length = nameLength;
+			}
+		}
+
+		// Returns the name that GL reports for the variable.
+		std::string getActiveName(NullVariable const & variable)
+		{
+			return variable.isArray ? variable.name + "[0]" : variable.name;
+		}
+
+		// Returns the location of the name, which may have an array index, or -1 if it is not one of the variables.
+		GLint findLocation(std::vector<NullVariable> const & variables, GLchar const * name)
+		{
+			std::string baseName = name;
+			GLint index = 0;
+			size_t bracket = baseName.find('[');
+			if (bracket != std::string::npos)
+			{
+				index = std::atoi(baseName.c_str() + bracket + 1);
+				baseName.resize(bracket);
+			}
+			for (auto const & variable : variables)
+			{
+				if (variable.name == baseName && index >= 0 && index < variable.size)
+				{
+					return variable.location + index;
+				}
+			}
+			return -1;
+		}
+
+		GLuint APIENTRY nullCreateProgram()
+		{
+			countCall(glCreateProgramId);
+			programs[nextObjectId];
+			return nextObjectId++;
+		}
+
+		GLuint APIENTRY nullCreateShader(GLenum type)
+		{
+			countCall(glCreateShaderId);
+			shaders[nextObjectId].type = type;
+			return nextObjectId++;
+		}
+
+		void APIENTRY nullDeleteProgram(GLuint program) { countCall(glDeleteProgramId); programs.erase(program); }
+		void APIENTRY nullDeleteShader(GLuint shader) { countCall(glDeleteShaderId); shaders.erase(shader); }
+
+		void APIENTRY nullShaderSource(GLuint shader, GLsizei count, GLchar const * const * strings, GLint const * lengths)
+		{
+			countCall(glShaderSourceId);
+			std::string & source = shaders[shader].source;
+			source.clear();
+			for (GLsizei i = 0; i < count; i++)
+			{
+				if (lengths != nullptr && lengths[i] >= 0)
+				{
+					source.append(strings[i], lengths[i]);
+				}
+				else
+				{
+					source.append(strings[i]);
+				}
+			}
+		}
+
+		void APIENTRY nullAttachShader(GLuint program, GLuint shader)
+		{
+			countCall(glAttachShaderId);
+			programs[program].shaders.push_back(shader);
+		}
+
+		void APIENTRY nullLinkProgram(GLuint program_)
+		{
+			countCall(glLinkProgramId);
+			NullProgram & program = programs[program_];
+			program.uniforms.clear();
+			program.uniformBlocks.clear();
+			program.attributes.clear();
+			for (auto shader : program.shaders)
+			{
+				auto it = shaders.find(shader);
+				if (it != shaders.end())
+				{
+					parseDeclarations(it->second, program);
+				}
+			}
+
+			// Each uniform element takes a location. The attributes without one take the next free ones.
+			GLint nextLocation = 0;
+			for (auto & uniform : program.uniforms)
+			{
+				uniform.location = nextLocation;
+				nextLocation += uniform.size;
+			}
+			nextLocation = 0;
+			for (auto const & attribute : program.attributes)
+			{
+				if (attribute.location != -1)
+				{
+					nextLocation = std::max(nextLocation, attribute.location + attribute.size * getNumAttributeLocations(attribute.type));
+				}
+			}
+			for (auto & attribute : program.attributes)
+			{
+				if (attribute.location == -1)
+				{
+					attribute.location = nextLocation;
+					nextLocation += attribute.size * getNumAttributeLocations(attribute.type);
+				}
+			}
+		}
+
+		void APIENTRY nullGetShaderiv(GLuint, GLenum pname, GLint * params)
+		{
+			countCall(glGetShaderivId);
+			*params = (pname == GL_COMPILE_STATUS) ? GL_TRUE : 0;
+		}
+
+		void APIENTRY nullGetProgramiv(GLuint program_, GLenum pname, GLint * params)
+		{
+			countCall(glGetProgramivId);
+			NullProgram const & program = programs[program_];
+			*params = 0;
+			switch (pname)
+			{
+				case GL_LINK_STATUS: case GL_VALIDATE_STATUS: *params = GL_TRUE; break;
+				case GL_ACTIVE_UNIFORMS: *params = (GLint)program.uniforms.size(); break;
+				case GL_ACTIVE_ATTRIBUTES: *params = (GLint)program.attributes.size(); break;
+				case GL_ACTIVE_UNIFORM_BLOCKS: *params = (GLint)program.uniformBlocks.size(); break;
+				case GL_ACTIVE_UNIFORM_MAX_LENGTH:
+					for (auto const & uniform : program.uniforms)
+					{
+						*params = std::max(*params, (GLint)getActiveName(uniform).size() + 1);
+					}
+					break;
+				case GL_ACTIVE_ATTRIBUTE_MAX_LENGTH:
+					for (auto const & attribute : program.attributes)
+					{
+						*params = std::max(*params, (GLint)getActiveName(attribute).size() + 1);
+					}
+					break;
+				case GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH:
+					for (auto const & block : program.uniformBlocks)
+					{
+						*params = std::max(*params, (GLint)block.size() + 1);
+					}
+					break;
+			}
+		}
+
+		void APIENTRY nullGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name)
+		{
+			countCall(glGetActiveUniformId);
+			NullVariable const & uniform = programs[program].uniforms.at(index);
+			copyName(getActiveName(uniform), bufSize, length, name);
+			*size = uniform.size;
+			*type = uniform.type;
+		}
+
+		void APIENTRY nullGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLint * size, GLenum * type, GLchar * name)
+		{
+			countCall(glGetActiveAttribId);
+			NullVariable const & attribute = programs[program].attributes.at(index);
+			copyName(getActiveName(attribute), bufSize, length, name);
+			*size = attribute.size;
+			*type = attribute.type;
+		}
+
+		void APIENTRY nullGetActiveUniformBlockName(GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLchar * name)
+		{
+			countCall(glGetActiveUniformBlockNameId);
+			copyName(programs[program].uniformBlocks.at(index), bufSize, length, name);
+		}
+
+		void APIENTRY nullGetIntegerv(GLenum, GLint * data)
+		{
+			countCall(glGetIntegervId);
+			*data = 0;
+		}
+
+		GLubyte const * APIENTRY nullGetString(GLenum name)
+		{
+			countCall(glGetStringId);
+			return (GLubyte const *)(name == GL_SHADING_LANGUAGE_VERSION ? "4.30" : name == GL_VERSION ? "4.3 null" : "null");
+		}
+
+		GLint APIENTRY nullGetAttribLocation(GLuint program, GLchar const * name) { countCall(glGetAttribLocationId); return findLocation(programs[program].attributes, name); }
+		GLint APIENTRY nullGetUniformLocation(GLuint program, GLchar const * name) { countCall(glGetUniformLocationId); return findLocation(programs[program].uniforms, name); }
+
+		GLuint APIENTRY nullGetUniformBlockIndex(GLuint program, GLchar const * name)
+		{
+			countCall(glGetUniformBlockIndexId);
+			auto const & blocks = programs[program].uniformBlocks;
+			auto it = std::find(blocks.begin(), blocks.end(), name);
+			return (it != blocks.end()) ? (GLuint)(it - blocks.begin()) : GL_INVALID_INDEX;
+		}
+		GLenum APIENTRY nullCheckFramebufferStatus(GLenum) { countCall(glCheckFramebufferStatusId); return GL_FRAMEBUFFER_COMPLETE; }
+
+		void APIENTRY nullUseProgram(GLuint program) { countCall(glUseProgramId); record.program = program; }
+		void APIENTRY nullBindVertexArray(GLuint array) { countCall(glBindVertexArrayId); record.vertexArray = array; }
+		void APIENTRY nullBindFramebuffer(GLenum, GLuint framebuffer) { countCall(glBindFramebufferId); record.framebuffer = framebuffer; }
+		void APIENTRY nullActiveTexture(GLenum texture) { countCall(glActiveTextureId); record.activeTexture = texture - GL_TEXTURE0; }
+
+		void APIENTRY nullBindBuffer(GLenum target, GLuint buffer)
+		{
+			countCall(glBindBufferId);
+			switch (target)
+			{
+				case GL_ARRAY_BUFFER: record.arrayBuffer = buffer; break;
+				case GL_ELEMENT_ARRAY_BUFFER: record.elementArrayBuffer = buffer; break;
+				case GL_UNIFORM_BUFFER: record.uniformBuffer = buffer; break;
+			}
+		}
+
+		void APIENTRY nullBindBufferBase(GLenum target, GLuint, GLuint buffer)
+		{
+			countCall(glBindBufferBaseId);
+			if (target == GL_UNIFORM_BUFFER)
+			{
+				record.uniformBuffer = buffer;
+			}
+		}
+
+		void APIENTRY nullBindTexture(GLenum, GLuint texture)
+		{
+			countCall(glBindTextureId);
+			if (record.activeTexture >= record.textures.size())
+			{
+				record.textures.resize(record.activeTexture + 1, 0);
+			}
+			record.textures[record.activeTexture] = texture;
+		}
+
+		void APIENTRY nullBufferData(GLenum, GLsizeiptr size, void const * data, GLenum)
+		{
+			countCall(glBufferDataId);
+			if (data != nullptr)
+			{
+				record.numBufferBytes += size;
+			}
+		}
+
+		void APIENTRY nullBufferSubData(GLenum, GLintptr, GLsizeiptr size, void const *)
+		{
+			countCall(glBufferSubDataId);
+			record.numBufferBytes += size;
+		}
+
+		void APIENTRY nullTexImage2D(GLenum, GLint, GLint, GLsizei width, GLsizei height, GLint, GLenum format, GLenum type, void const * pixels)
+		{
+			countCall(glTexImage2DId);
+			if (pixels != nullptr)
+			{
+				record.numTextureBytes += (uint64_t)width * height * getBytesPerPixel(format, type);
+			}
+		}
+
+		void APIENTRY nullTexSubImage2D(GLenum, GLint, GLint, GLint, GLsizei width, GLsizei height, GLenum format, GLenum type, void const *)
+		{
+			countCall(glTexSubImage2DId);
+			record.numTextureBytes += (uint64_t)width * height * getBytesPerPixel(format, type);
+		}
+
+		void APIENTRY nullDrawArrays(GLenum, GLint, GLsizei) { countCall(glDrawArraysId); record.numDrawCalls++; }
+		void APIENTRY nullDrawElements(GLenum, GLsizei, GLenum, void const *) { countCall(glDrawElementsId); record.numDrawCalls++; }
+		void APIENTRY nullDrawArraysInstanced(GLenum, GLint, GLsizei, GLsizei) { countCall(glDrawArraysInstancedId); record.numDrawCalls++; }
+		void APIENTRY nullDrawElementsInstanced(GLenum, GLsizei, GLenum, void const *, GLsizei) { countCall(glDrawElementsInstancedId); record.numDrawCalls++; }
+
+		void APIENTRY nullUniform1i(GLint, GLint) { countCall(glUniform1iId); record.numUniformBytes += sizeof(GLint); }
+		void APIENTRY nullUniform1f(GLint, GLfloat) { countCall(glUniform1fId); record.numUniformBytes += sizeof(GLfloat); }
+		void APIENTRY nullUniform2iv(GLint, GLsizei count, GLint const *) { countCall(glUniform2ivId); record.numUniformBytes += count * 2 * sizeof(GLint); }
+		void APIENTRY nullUniform3iv(GLint, GLsizei count, GLint const *) { countCall(glUniform3ivId); record.numUniformBytes += count * 3 * sizeof(GLint); }
+		void APIENTRY nullUniform4iv(GLint, GLsizei count, GLint const *) { countCall(glUniform4ivId); record.numUniformBytes += count * 4 * sizeof(GLint); }
+		void APIENTRY nullUniform2fv(GLint, GLsizei count, GLfloat const *) { countCall(glUniform2fvId); record.numUniformBytes += count * 2 * sizeof(GLfloat); }
+		void APIENTRY nullUniform3fv(GLint, GLsizei count, GLfloat const *) { countCall(glUniform3fvId); record.numUniformBytes += count * 3 * sizeof(GLfloat); }
+		void APIENTRY nullUniform4fv(GLint, GLsizei count, GLfloat const *) { countCall(glUniform4fvId); record.numUniformBytes += count * 4 * sizeof(GLfloat); }
+		void APIENTRY nullUniformMatrix2fv(GLint, GLsizei count, GLboolean, GLfloat const *) { countCall(glUniformMatrix2fvId); record.numUniformBytes += count * 4 * sizeof(GLfloat); }
+		void APIENTRY nullUniformMatrix3fv(GLint, GLsizei count, GLboolean, GLfloat const *) { countCall(glUniformMatrix3fvId); record.numUniformBytes += count * 9 * sizeof(GLfloat); }
+		void APIENTRY nullUniformMatrix4fv(GLint, GLsizei count, GLboolean, GLfloat const *) { countCall(glUniformMatrix4fvId); record.numUniformBytes += count * 16 * sizeof(GLfloat); }
+
+		void glUseNullBackend(bool nullBackend_)
+		{
+			nullBackend = nullBackend_;
+		}
+
+		bool glIsNullBackend()
+		{
+			return nullBackend;
+		}
+
+		GLNullRecord glGetNullRecord()
+		{
+			GLNullRecord result = record;
+			for (unsigned int id = 0; id < numFunctionIds; id++)
+			{
+				if (callCounts[id] > 0)
+				{
+					result.callCounts[functionNames[id]] = callCounts[id];
+				}
+			}
+			return result;
+		}
+
+		void glResetNullRecord()
+		{
+			for (unsigned int id = 0; id < numFunctionIds; id++)
+			{
+				callCounts[id] = 0;
+			}
+			record.numCalls = 0;
+			record.numDrawCalls = 0;
+			record.numBufferBytes = 0;
+			record.numTextureBytes = 0;
+			record.numUniformBytes = 0;
+		}
+
+		// Called by glInitialize in place of getting the functions from the GL context.
+		void glInitializeNull()
+		{
+#define VE_NULL_FUNCTION(function, type) function = NullFunction<type, function##Id>::call; functionNames[function##Id] = #function
+			VE_NULL_FUNCTION(glCullFace, PFNGLCULLFACEPROC);
+			VE_NULL_FUNCTION(glFrontFace, PFNGLFRONTFACEPROC);
+			VE_NULL_FUNCTION(glHint, PFNGLHINTPROC);
+			VE_NULL_FUNCTION(glLineWidth, PFNGLLINEWIDTHPROC);
+			VE_NULL_FUNCTION(glPointSize, PFNGLPOINTSIZEPROC);
+			VE_NULL_FUNCTION(glPolygonMode, PFNGLPOLYGONMODEPROC);
+			VE_NULL_FUNCTION(glScissor, PFNGLSCISSORPROC);
+			VE_NULL_FUNCTION(glTexParameterf, PFNGLTEXPARAMETERFPROC);
+			VE_NULL_FUNCTION(glTexParameterfv, PFNGLTEXPARAMETERFVPROC);
+			VE_NULL_FUNCTION(glTexParameteri, PFNGLTEXPARAMETERIPROC);
+			VE_NULL_FUNCTION(glTexParameteriv, PFNGLTEXPARAMETERIVPROC);
+			VE_NULL_FUNCTION(glTexImage1D, PFNGLTEXIMAGE1DPROC);
+			VE_NULL_FUNCTION(glTexImage2D, PFNGLTEXIMAGE2DPROC);
+			VE_NULL_FUNCTION(glDrawBuffer, PFNGLDRAWBUFFERPROC);
+			VE_NULL_FUNCTION(glClear, PFNGLCLEARPROC);
+			VE_NULL_FUNCTION(glClearColor, PFNGLCLEARCOLORPROC);
+			VE_NULL_FUNCTION(glClearStencil, PFNGLCLEARSTENCILPROC);
+			VE_NULL_FUNCTION(glClearDepth, PFNGLCLEARDEPTHPROC);
+			VE_NULL_FUNCTION(glStencilMask, PFNGLSTENCILMASKPROC);
+			VE_NULL_FUNCTION(glColorMask, PFNGLCOLORMASKPROC);
+			VE_NULL_FUNCTION(glDepthMask, PFNGLDEPTHMASKPROC);
+			VE_NULL_FUNCTION(glDisable, PFNGLDISABLEPROC);
+			VE_NULL_FUNCTION(glEnable, PFNGLENABLEPROC);
+			VE_NULL_FUNCTION(glFinish, PFNGLFINISHPROC);
+			VE_NULL_FUNCTION(glFlush, PFNGLFLUSHPROC);
+			VE_NULL_FUNCTION(glBlendFunc, PFNGLBLENDFUNCPROC);
+			VE_NULL_FUNCTION(glLogicOp, PFNGLLOGICOPPROC);
+			VE_NULL_FUNCTION(glStencilFunc, PFNGLSTENCILFUNCPROC);
+			VE_NULL_FUNCTION(glStencilOp, PFNGLSTENCILOPPROC);
+			VE_NULL_FUNCTION(glDepthFunc, PFNGLDEPTHFUNCPROC);
+			VE_NULL_FUNCTION(glPixelStoref, PFNGLPIXELSTOREFPROC);
+			VE_NULL_FUNCTION(glPixelStorei, PFNGLPIXELSTOREIPROC);
+			VE_NULL_FUNCTION(glReadBuffer, PFNGLREADBUFFERPROC);
+			VE_NULL_FUNCTION(glReadPixels, PFNGLREADPIXELSPROC);
+			VE_NULL_FUNCTION(glGetBooleanv, PFNGLGETBOOLEANVPROC);
+			VE_NULL_FUNCTION(glGetDoublev, PFNGLGETDOUBLEVPROC);
+			VE_NULL_FUNCTION(glGetError, PFNGLGETERRORPROC);
+			VE_NULL_FUNCTION(glGetFloatv, PFNGLGETFLOATVPROC);
+			VE_NULL_FUNCTION(glGetIntegerv, PFNGLGETINTEGERVPROC);
+			VE_NULL_FUNCTION(glGetString, PFNGLGETSTRINGPROC);
+			VE_NULL_FUNCTION(glGetTexImage, PFNGLGETTEXIMAGEPROC);
+			VE_NULL_FUNCTION(glGetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC);
+			VE_NULL_FUNCTION(glGetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC);
+			VE_NULL_FUNCTION(glGetTexLevelParameterfv, PFNGLGETTEXLEVELPARAMETERFVPROC);
+			VE_NULL_FUNCTION(glGetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC);
+			VE_NULL_FUNCTION(glIsEnabled, PFNGLISENABLEDPROC);
+			VE_NULL_FUNCTION(glDepthRange, PFNGLDEPTHRANGEPROC);
+			VE_NULL_FUNCTION(glViewport, PFNGLVIEWPORTPROC);
+			VE_NULL_FUNCTION(glDrawArrays, PFNGLDRAWARRAYSPROC);
+			VE_NULL_FUNCTION(glDrawElements, PFNGLDRAWELEMENTSPROC);
+			VE_NULL_FUNCTION(glGetPointerv, PFNGLGETPOINTERVPROC);
+			VE_NULL_FUNCTION(glPolygonOffset, PFNGLPOLYGONOFFSETPROC);
+			VE_NULL_FUNCTION(glCopyTexImage1D, PFNGLCOPYTEXIMAGE1DPROC);
+			VE_NULL_FUNCTION(glCopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC);
+			VE_NULL_FUNCTION(glCopyTexSubImage1D, PFNGLCOPYTEXSUBIMAGE1DPROC);
+			VE_NULL_FUNCTION(glCopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC);
+			VE_NULL_FUNCTION(glTexSubImage1D, PFNGLTEXSUBIMAGE1DPROC);
+			VE_NULL_FUNCTION(glTexSubImage2D, PFNGLTEXSUBIMAGE2DPROC);
+			VE_NULL_FUNCTION(glBindTexture, PFNGLBINDTEXTUREPROC);
+			VE_NULL_FUNCTION(glDeleteTextures, PFNGLDELETETEXTURESPROC);
+			VE_NULL_FUNCTION(glGenTextures, PFNGLGENTEXTURESPROC);
+			VE_NULL_FUNCTION(glIsTexture, PFNGLISTEXTUREPROC);
+			VE_NULL_FUNCTION(glDrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC);
+			VE_NULL_FUNCTION(glTexImage3D, PFNGLTEXIMAGE3DPROC);
+			VE_NULL_FUNCTION(glTexSubImage3D, PFNGLTEXSUBIMAGE3DPROC);
+			VE_NULL_FUNCTION(glCopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC);
+			VE_NULL_FUNCTION(glActiveTexture, PFNGLACTIVETEXTUREPROC);
+			VE_NULL_FUNCTION(glSampleCoverage, PFNGLSAMPLECOVERAGEPROC);
+			VE_NULL_FUNCTION(glCompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC);
+			VE_NULL_FUNCTION(glCompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC);
+			VE_NULL_FUNCTION(glCompressedTexImage1D, PFNGLCOMPRESSEDTEXIMAGE1DPROC);
+			VE_NULL_FUNCTION(glCompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC);
+			VE_NULL_FUNCTION(glCompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC);
+			VE_NULL_FUNCTION(glCompressedTexSubImage1D, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC);
+			VE_NULL_FUNCTION(glGetCompressedTexImage, PFNGLGETCOMPRESSEDTEXIMAGEPROC);
+			VE_NULL_FUNCTION(glBlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC);
+			VE_NULL_FUNCTION(glMultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC);
+			VE_NULL_FUNCTION(glMultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC);
+			VE_NULL_FUNCTION(glPointParameterf, PFNGLPOINTPARAMETERFPROC);
+			VE_NULL_FUNCTION(glPointParameterfv, PFNGLPOINTPARAMETERFVPROC);
+			VE_NULL_FUNCTION(glPointParameteri, PFNGLPOINTPARAMETERIPROC);
+			VE_NULL_FUNCTION(glPointParameteriv, PFNGLPOINTPARAMETERIVPROC);
+			VE_NULL_FUNCTION(glBlendColor, PFNGLBLENDCOLORPROC);
+			VE_NULL_FUNCTION(glBlendEquation, PFNGLBLENDEQUATIONPROC);
+			VE_NULL_FUNCTION(glGenQueries, PFNGLGENQUERIESPROC);
+			VE_NULL_FUNCTION(glDeleteQueries, PFNGLDELETEQUERIESPROC);
+			VE_NULL_FUNCTION(glIsQuery, PFNGLISQUERYPROC);
+			VE_NULL_FUNCTION(glBeginQuery, PFNGLBEGINQUERYPROC);
+			VE_NULL_FUNCTION(glEndQuery, PFNGLENDQUERYPROC);
+			VE_NULL_FUNCTION(glGetQueryiv, PFNGLGETQUERYIVPROC);
+			VE_NULL_FUNCTION(glGetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC);
+			VE_NULL_FUNCTION(glGetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC);
+			VE_NULL_FUNCTION(glBindBuffer, PFNGLBINDBUFFERPROC);
+			VE_NULL_FUNCTION(glDeleteBuffers, PFNGLDELETEBUFFERSPROC);
+			VE_NULL_FUNCTION(glGenBuffers, PFNGLGENBUFFERSPROC);
+			VE_NULL_FUNCTION(glIsBuffer, PFNGLISBUFFERPROC);
+			VE_NULL_FUNCTION(glBufferData, PFNGLBUFFERDATAPROC);
+			VE_NULL_FUNCTION(glBufferSubData, PFNGLBUFFERSUBDATAPROC);
+			VE_NULL_FUNCTION(glGetBufferSubData, PFNGLGETBUFFERSUBDATAPROC);
+			VE_NULL_FUNCTION(glMapBuffer, PFNGLMAPBUFFERPROC);
+			VE_NULL_FUNCTION(glUnmapBuffer, PFNGLUNMAPBUFFERPROC);
+			VE_NULL_FUNCTION(glGetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC);
+			VE_NULL_FUNCTION(glGetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC);
+			VE_NULL_FUNCTION(glBlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC);
+			VE_NULL_FUNCTION(glDrawBuffers, PFNGLDRAWBUFFERSPROC);
+			VE_NULL_FUNCTION(glStencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC);
+			VE_NULL_FUNCTION(glStencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC);
+			VE_NULL_FUNCTION(glStencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC);
+			VE_NULL_FUNCTION(glAttachShader, PFNGLATTACHSHADERPROC);
+			VE_NULL_FUNCTION(glBindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC);
+			VE_NULL_FUNCTION(glCompileShader, PFNGLCOMPILESHADERPROC);
+			VE_NULL_FUNCTION(glCreateProgram, PFNGLCREATEPROGRAMPROC);
+			VE_NULL_FUNCTION(glCreateShader, PFNGLCREATESHADERPROC);
+			VE_NULL_FUNCTION(glDeleteProgram, PFNGLDELETEPROGRAMPROC);
+			VE_NULL_FUNCTION(glDeleteShader, PFNGLDELETESHADERPROC);
+			VE_NULL_FUNCTION(glDetachShader, PFNGLDETACHSHADERPROC);
+			VE_NULL_FUNCTION(glDisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC);
+			VE_NULL_FUNCTION(glEnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC);
+			VE_NULL_FUNCTION(glGetActiveAttrib, PFNGLGETACTIVEATTRIBPROC);
+			VE_NULL_FUNCTION(glGetActiveUniform, PFNGLGETACTIVEUNIFORMPROC);
+			VE_NULL_FUNCTION(glGetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC);
+			VE_NULL_FUNCTION(glGetAttribLocation, PFNGLGETATTRIBLOCATIONPROC);
+			VE_NULL_FUNCTION(glGetProgramiv, PFNGLGETPROGRAMIVPROC);
+			VE_NULL_FUNCTION(glGetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC);
+			VE_NULL_FUNCTION(glGetShaderiv, PFNGLGETSHADERIVPROC);
+			VE_NULL_FUNCTION(glGetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC);
+			VE_NULL_FUNCTION(glGetShaderSource, PFNGLGETSHADERSOURCEPROC);
+			VE_NULL_FUNCTION(glGetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC);
+			VE_NULL_FUNCTION(glGetUniformfv, PFNGLGETUNIFORMFVPROC);
+			VE_NULL_FUNCTION(glGetUniformiv, PFNGLGETUNIFORMIVPROC);
+			VE_NULL_FUNCTION(glGetVertexAttribdv, PFNGLGETVERTEXATTRIBDVPROC);
+			VE_NULL_FUNCTION(glGetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC);
+			VE_NULL_FUNCTION(glGetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC);
+			VE_NULL_FUNCTION(glGetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC);
+			VE_NULL_FUNCTION(glIsProgram, PFNGLISPROGRAMPROC);
+			VE_NULL_FUNCTION(glIsShader, PFNGLISSHADERPROC);
+			VE_NULL_FUNCTION(glLinkProgram, PFNGLLINKPROGRAMPROC);
+			VE_NULL_FUNCTION(glShaderSource, PFNGLSHADERSOURCEPROC);
+			VE_NULL_FUNCTION(glUseProgram, PFNGLUSEPROGRAMPROC);
+			VE_NULL_FUNCTION(glUniform1f, PFNGLUNIFORM1FPROC);
+			VE_NULL_FUNCTION(glUniform2f, PFNGLUNIFORM2FPROC);
+			VE_NULL_FUNCTION(glUniform3f, PFNGLUNIFORM3FPROC);
+			VE_NULL_FUNCTION(glUniform4f, PFNGLUNIFORM4FPROC);
+			VE_NULL_FUNCTION(glUniform1i, PFNGLUNIFORM1IPROC);
+			VE_NULL_FUNCTION(glUniform2i, PFNGLUNIFORM2IPROC);
+			VE_NULL_FUNCTION(glUniform3i, PFNGLUNIFORM3IPROC);
+			VE_NULL_FUNCTION(glUniform4i, PFNGLUNIFORM4IPROC);
+			VE_NULL_FUNCTION(glUniform1fv, PFNGLUNIFORM1FVPROC);
+			VE_NULL_FUNCTION(glUniform2fv, PFNGLUNIFORM2FVPROC);
+			VE_NULL_FUNCTION(glUniform3fv, PFNGLUNIFORM3FVPROC);
+			VE_NULL_FUNCTION(glUniform4fv, PFNGLUNIFORM4FVPROC);
+			VE_NULL_FUNCTION(glUniform1iv, PFNGLUNIFORM1IVPROC);
+			VE_NULL_FUNCTION(glUniform2iv, PFNGLUNIFORM2IVPROC);
+			VE_NULL_FUNCTION(glUniform3iv, PFNGLUNIFORM3IVPROC);
+			VE_NULL_FUNCTION(glUniform4iv, PFNGLUNIFORM4IVPROC);
+			VE_NULL_FUNCTION(glUniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC);
+			VE_NULL_FUNCTION(glUniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC);
+			VE_NULL_FUNCTION(glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC);
+			VE_NULL_FUNCTION(glValidateProgram, PFNGLVALIDATEPROGRAMPROC);
+			VE_NULL_FUNCTION(glVertexAttrib1d, PFNGLVERTEXATTRIB1DPROC);
+			VE_NULL_FUNCTION(glVertexAttrib1dv, PFNGLVERTEXATTRIB1DVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib1f, PFNGLVERTEXATTRIB1FPROC);
+			VE_NULL_FUNCTION(glVertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib1s, PFNGLVERTEXATTRIB1SPROC);
+			VE_NULL_FUNCTION(glVertexAttrib1sv, PFNGLVERTEXATTRIB1SVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib2d, PFNGLVERTEXATTRIB2DPROC);
+			VE_NULL_FUNCTION(glVertexAttrib2dv, PFNGLVERTEXATTRIB2DVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib2f, PFNGLVERTEXATTRIB2FPROC);
+			VE_NULL_FUNCTION(glVertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib2s, PFNGLVERTEXATTRIB2SPROC);
+			VE_NULL_FUNCTION(glVertexAttrib2sv, PFNGLVERTEXATTRIB2SVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib3d, PFNGLVERTEXATTRIB3DPROC);
+			VE_NULL_FUNCTION(glVertexAttrib3dv, PFNGLVERTEXATTRIB3DVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib3f, PFNGLVERTEXATTRIB3FPROC);
+			VE_NULL_FUNCTION(glVertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib3s, PFNGLVERTEXATTRIB3SPROC);
+			VE_NULL_FUNCTION(glVertexAttrib3sv, PFNGLVERTEXATTRIB3SVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4Nbv, PFNGLVERTEXATTRIB4NBVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4Niv, PFNGLVERTEXATTRIB4NIVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4Nsv, PFNGLVERTEXATTRIB4NSVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4Nub, PFNGLVERTEXATTRIB4NUBPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4Nubv, PFNGLVERTEXATTRIB4NUBVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4Nuiv, PFNGLVERTEXATTRIB4NUIVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4Nusv, PFNGLVERTEXATTRIB4NUSVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4bv, PFNGLVERTEXATTRIB4BVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4d, PFNGLVERTEXATTRIB4DPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4dv, PFNGLVERTEXATTRIB4DVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4f, PFNGLVERTEXATTRIB4FPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4iv, PFNGLVERTEXATTRIB4IVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4s, PFNGLVERTEXATTRIB4SPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4sv, PFNGLVERTEXATTRIB4SVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4ubv, PFNGLVERTEXATTRIB4UBVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4uiv, PFNGLVERTEXATTRIB4UIVPROC);
+			VE_NULL_FUNCTION(glVertexAttrib4usv, PFNGLVERTEXATTRIB4USVPROC);
+			VE_NULL_FUNCTION(glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC);
+			VE_NULL_FUNCTION(glUniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC);
+			VE_NULL_FUNCTION(glUniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC);
+			VE_NULL_FUNCTION(glUniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC);
+			VE_NULL_FUNCTION(glUniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC);
+			VE_NULL_FUNCTION(glUniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC);
+			VE_NULL_FUNCTION(glUniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC);
+			VE_NULL_FUNCTION(glColorMaski, PFNGLCOLORMASKIPROC);
+			VE_NULL_FUNCTION(glGetBooleani_v, PFNGLGETBOOLEANI_VPROC);
+			VE_NULL_FUNCTION(glGetIntegeri_v, PFNGLGETINTEGERI_VPROC);
+			VE_NULL_FUNCTION(glEnablei, PFNGLENABLEIPROC);
+			VE_NULL_FUNCTION(glDisablei, PFNGLDISABLEIPROC);
+			VE_NULL_FUNCTION(glIsEnabledi, PFNGLISENABLEDIPROC);
+			VE_NULL_FUNCTION(glBeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC);
+			VE_NULL_FUNCTION(glEndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC);
+			VE_NULL_FUNCTION(glBindBufferRange, PFNGLBINDBUFFERRANGEPROC);
+			VE_NULL_FUNCTION(glBindBufferBase, PFNGLBINDBUFFERBASEPROC);
+			VE_NULL_FUNCTION(glTransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC);
+			VE_NULL_FUNCTION(glGetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC);
+			VE_NULL_FUNCTION(glClampColor, PFNGLCLAMPCOLORPROC);
+			VE_NULL_FUNCTION(glBeginConditionalRender, PFNGLBEGINCONDITIONALRENDERPROC);
+			VE_NULL_FUNCTION(glEndConditionalRender, PFNGLENDCONDITIONALRENDERPROC);
+			VE_NULL_FUNCTION(glVertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC);
+			VE_NULL_FUNCTION(glGetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC);
+			VE_NULL_FUNCTION(glGetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC);
+			VE_NULL_FUNCTION(glVertexAttribI1i, PFNGLVERTEXATTRIBI1IPROC);
+			VE_NULL_FUNCTION(glVertexAttribI2i, PFNGLVERTEXATTRIBI2IPROC);
+			VE_NULL_FUNCTION(glVertexAttribI3i, PFNGLVERTEXATTRIBI3IPROC);
+			VE_NULL_FUNCTION(glVertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC);
+			VE_NULL_FUNCTION(glVertexAttribI1ui, PFNGLVERTEXATTRIBI1UIPROC);
+			VE_NULL_FUNCTION(glVertexAttribI2ui, PFNGLVERTEXATTRIBI2UIPROC);
+			VE_NULL_FUNCTION(glVertexAttribI3ui, PFNGLVERTEXATTRIBI3UIPROC);
+			VE_NULL_FUNCTION(glVertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC);
+			VE_NULL_FUNCTION(glVertexAttribI1iv, PFNGLVERTEXATTRIBI1IVPROC);
+			VE_NULL_FUNCTION(glVertexAttribI2iv, PFNGLVERTEXATTRIBI2IVPROC);
+			VE_NULL_FUNCTION(glVertexAttribI3iv, PFNGLVERTEXATTRIBI3IVPROC);
+			VE_NULL_FUNCTION(glVertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC);
+			VE_NULL_FUNCTION(glVertexAttribI1uiv, PFNGLVERTEXATTRIBI1UIVPROC);
+			VE_NULL_FUNCTION(glVertexAttribI2uiv, PFNGLVERTEXATTRIBI2UIVPROC);
+			VE_NULL_FUNCTION(glVertexAttribI3uiv, PFNGLVERTEXATTRIBI3UIVPROC);
+			VE_NULL_FUNCTION(glVertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC);
+			VE_NULL_FUNCTION(glVertexAttribI4bv, PFNGLVERTEXATTRIBI4BVPROC);
+			VE_NULL_FUNCTION(glVertexAttribI4sv, PFNGLVERTEXATTRIBI4SVPROC);
+			VE_NULL_FUNCTION(glVertexAttribI4ubv, PFNGLVERTEXATTRIBI4UBVPROC);
+			VE_NULL_FUNCTION(glVertexAttribI4usv, PFNGLVERTEXATTRIBI4USVPROC);
+			VE_NULL_FUNCTION(glGetUniformuiv, PFNGLGETUNIFORMUIVPROC);
+			VE_NULL_FUNCTION(glBindFragDataLocation, PFNGLBINDFRAGDATALOCATIONPROC);
+			VE_NULL_FUNCTION(glGetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC);
+			VE_NULL_FUNCTION(glUniform1ui, PFNGLUNIFORM1UIPROC);
+			VE_NULL_FUNCTION(glUniform2ui, PFNGLUNIFORM2UIPROC);
+			VE_NULL_FUNCTION(glUniform3ui, PFNGLUNIFORM3UIPROC);
+			VE_NULL_FUNCTION(glUniform4ui, PFNGLUNIFORM4UIPROC);
+			VE_NULL_FUNCTION(glUniform1uiv, PFNGLUNIFORM1UIVPROC);
+			VE_NULL_FUNCTION(glUniform2uiv, PFNGLUNIFORM2UIVPROC);
+			VE_NULL_FUNCTION(glUniform3uiv, PFNGLUNIFORM3UIVPROC);
+			VE_NULL_FUNCTION(glUniform4uiv, PFNGLUNIFORM4UIVPROC);
+			VE_NULL_FUNCTION(glTexParameterIiv, PFNGLTEXPARAMETERIIVPROC);
+			VE_NULL_FUNCTION(glTexParameterIuiv, PFNGLTEXPARAMETERIUIVPROC);
+			VE_NULL_FUNCTION(glGetTexParameterIiv, PFNGLGETTEXPARAMETERIIVPROC);
+			VE_NULL_FUNCTION(glGetTexParameterIuiv, PFNGLGETTEXPARAMETERIUIVPROC);
+			VE_NULL_FUNCTION(glClearBufferiv, PFNGLCLEARBUFFERIVPROC);
+			VE_NULL_FUNCTION(glClearBufferuiv, PFNGLCLEARBUFFERUIVPROC);
+			VE_NULL_FUNCTION(glClearBufferfv, PFNGLCLEARBUFFERFVPROC);
+			VE_NULL_FUNCTION(glClearBufferfi, PFNGLCLEARBUFFERFIPROC);
+			VE_NULL_FUNCTION(glGetStringi, PFNGLGETSTRINGIPROC);
+			VE_NULL_FUNCTION(glIsRenderbuffer, PFNGLISRENDERBUFFERPROC);
+			VE_NULL_FUNCTION(glBindRenderbuffer, PFNGLBINDRENDERBUFFERPROC);
+			VE_NULL_FUNCTION(glDeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC);
+			VE_NULL_FUNCTION(glGenRenderbuffers, PFNGLGENRENDERBUFFERSPROC);
+			VE_NULL_FUNCTION(glRenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC);
+			VE_NULL_FUNCTION(glGetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC);
+			VE_NULL_FUNCTION(glIsFramebuffer, PFNGLISFRAMEBUFFERPROC);
+			VE_NULL_FUNCTION(glBindFramebuffer, PFNGLBINDFRAMEBUFFERPROC);
+			VE_NULL_FUNCTION(glDeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC);
+			VE_NULL_FUNCTION(glGenFramebuffers, PFNGLGENFRAMEBUFFERSPROC);
+			VE_NULL_FUNCTION(glCheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC);
+			VE_NULL_FUNCTION(glFramebufferTexture1D, PFNGLFRAMEBUFFERTEXTURE1DPROC);
+			VE_NULL_FUNCTION(glFramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC);
+			VE_NULL_FUNCTION(glFramebufferTexture3D, PFNGLFRAMEBUFFERTEXTURE3DPROC);
+			VE_NULL_FUNCTION(glFramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC);
+			VE_NULL_FUNCTION(glGetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC);
+			VE_NULL_FUNCTION(glGenerateMipmap, PFNGLGENERATEMIPMAPPROC);
+			VE_NULL_FUNCTION(glBlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC);
+			VE_NULL_FUNCTION(glRenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC);
+			VE_NULL_FUNCTION(glFramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC);
+			VE_NULL_FUNCTION(glMapBufferRange, PFNGLMAPBUFFERRANGEPROC);
+			VE_NULL_FUNCTION(glFlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC);
+			VE_NULL_FUNCTION(glBindVertexArray, PFNGLBINDVERTEXARRAYPROC);
+			VE_NULL_FUNCTION(glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC);
+			VE_NULL_FUNCTION(glGenVertexArrays, PFNGLGENVERTEXARRAYSPROC);
+			VE_NULL_FUNCTION(glIsVertexArray, PFNGLISVERTEXARRAYPROC);
+			VE_NULL_FUNCTION(glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC);
+			VE_NULL_FUNCTION(glDrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC);
+			VE_NULL_FUNCTION(glTexBuffer, PFNGLTEXBUFFERPROC);
+			VE_NULL_FUNCTION(glPrimitiveRestartIndex, PFNGLPRIMITIVERESTARTINDEXPROC);
+			VE_NULL_FUNCTION(glCopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC);
+			VE_NULL_FUNCTION(glGetUniformIndices, PFNGLGETUNIFORMINDICESPROC);
+			VE_NULL_FUNCTION(glGetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC);
+			VE_NULL_FUNCTION(glGetActiveUniformName, PFNGLGETACTIVEUNIFORMNAMEPROC);
+			VE_NULL_FUNCTION(glGetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC);
+			VE_NULL_FUNCTION(glGetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC);
+			VE_NULL_FUNCTION(glGetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC);
+			VE_NULL_FUNCTION(glUniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC);
+			VE_NULL_FUNCTION(glDrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC);
+			VE_NULL_FUNCTION(glDrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC);
+			VE_NULL_FUNCTION(glDrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC);
+			VE_NULL_FUNCTION(glMultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC);
+			VE_NULL_FUNCTION(glProvokingVertex, PFNGLPROVOKINGVERTEXPROC);
+			VE_NULL_FUNCTION(glFenceSync, PFNGLFENCESYNCPROC);
+			VE_NULL_FUNCTION(glIsSync, PFNGLISSYNCPROC);
+			VE_NULL_FUNCTION(glDeleteSync, PFNGLDELETESYNCPROC);
+			VE_NULL_FUNCTION(glClientWaitSync, PFNGLCLIENTWAITSYNCPROC);
+			VE_NULL_FUNCTION(glWaitSync, PFNGLWAITSYNCPROC);
+			VE_NULL_FUNCTION(glGetInteger64v, PFNGLGETINTEGER64VPROC);
+			VE_NULL_FUNCTION(glGetSynciv, PFNGLGETSYNCIVPROC);
+			VE_NULL_FUNCTION(glGetInteger64i_v, PFNGLGETINTEGER64I_VPROC);
+			VE_NULL_FUNCTION(glGetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC);
+			VE_NULL_FUNCTION(glFramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC);
+			VE_NULL_FUNCTION(glTexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC);
+			VE_NULL_FUNCTION(glTexImage3DMultisample, PFNGLTEXIMAGE3DMULTISAMPLEPROC);
+			VE_NULL_FUNCTION(glGetMultisamplefv, PFNGLGETMULTISAMPLEFVPROC);
+			VE_NULL_FUNCTION(glSampleMaski, PFNGLSAMPLEMASKIPROC);
+			VE_NULL_FUNCTION(glBindFragDataLocationIndexed, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC);
+			VE_NULL_FUNCTION(glGetFragDataIndex, PFNGLGETFRAGDATAINDEXPROC);
+			VE_NULL_FUNCTION(glGenSamplers, PFNGLGENSAMPLERSPROC);
+			VE_NULL_FUNCTION(glDeleteSamplers, PFNGLDELETESAMPLERSPROC);
+			VE_NULL_FUNCTION(glIsSampler, PFNGLISSAMPLERPROC);
+			VE_NULL_FUNCTION(glBindSampler, PFNGLBINDSAMPLERPROC);
+			VE_NULL_FUNCTION(glSamplerParameteri, PFNGLSAMPLERPARAMETERIPROC);
+			VE_NULL_FUNCTION(glSamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC);
+			VE_NULL_FUNCTION(glSamplerParameterf, PFNGLSAMPLERPARAMETERFPROC);
+			VE_NULL_FUNCTION(glSamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC);
+			VE_NULL_FUNCTION(glSamplerParameterIiv, PFNGLSAMPLERPARAMETERIIVPROC);
+			VE_NULL_FUNCTION(glSamplerParameterIuiv, PFNGLSAMPLERPARAMETERIUIVPROC);
+			VE_NULL_FUNCTION(glGetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC);
+			VE_NULL_FUNCTION(glGetSamplerParameterIiv, PFNGLGETSAMPLERPARAMETERIIVPROC);
+			VE_NULL_FUNCTION(glGetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC);
+			VE_NULL_FUNCTION(glGetSamplerParameterIuiv, PFNGLGETSAMPLERPARAMETERIUIVPROC);
+			VE_NULL_FUNCTION(glQueryCounter, PFNGLQUERYCOUNTERPROC);
+			VE_NULL_FUNCTION(glGetQueryObjecti64v, PFNGLGETQUERYOBJECTI64VPROC);
+			VE_NULL_FUNCTION(glGetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC);
+			VE_NULL_FUNCTION(glVertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC);
+			VE_NULL_FUNCTION(glVertexAttribP1ui, PFNGLVERTEXATTRIBP1UIPROC);
+			VE_NULL_FUNCTION(glVertexAttribP1uiv, PFNGLVERTEXATTRIBP1UIVPROC);
+			VE_NULL_FUNCTION(glVertexAttribP2ui, PFNGLVERTEXATTRIBP2UIPROC);
+			VE_NULL_FUNCTION(glVertexAttribP2uiv, PFNGLVERTEXATTRIBP2UIVPROC);
+			VE_NULL_FUNCTION(glVertexAttribP3ui, PFNGLVERTEXATTRIBP3UIPROC);
+			VE_NULL_FUNCTION(glVertexAttribP3uiv, PFNGLVERTEXATTRIBP3UIVPROC);
+			VE_NULL_FUNCTION(glVertexAttribP4ui, PFNGLVERTEXATTRIBP4UIPROC);
+			VE_NULL_FUNCTION(glVertexAttribP4uiv, PFNGLVERTEXATTRIBP4UIVPROC);
+			VE_NULL_FUNCTION(glMinSampleShading, PFNGLMINSAMPLESHADINGPROC);
+			VE_NULL_FUNCTION(glBlendEquationi, PFNGLBLENDEQUATIONIPROC);
+			VE_NULL_FUNCTION(glBlendEquationSeparatei, PFNGLBLENDEQUATIONSEPARATEIPROC);
+			VE_NULL_FUNCTION(glBlendFunci, PFNGLBLENDFUNCIPROC);
+			VE_NULL_FUNCTION(glBlendFuncSeparatei, PFNGLBLENDFUNCSEPARATEIPROC);
+			VE_NULL_FUNCTION(glDrawArraysIndirect, PFNGLDRAWARRAYSINDIRECTPROC);
+			VE_NULL_FUNCTION(glDrawElementsIndirect, PFNGLDRAWELEMENTSINDIRECTPROC);
+			VE_NULL_FUNCTION(glUniform1d, PFNGLUNIFORM1DPROC);
+			VE_NULL_FUNCTION(glUniform2d, PFNGLUNIFORM2DPROC);
+			VE_NULL_FUNCTION(glUniform3d, PFNGLUNIFORM3DPROC);
+			VE_NULL_FUNCTION(glUniform4d, PFNGLUNIFORM4DPROC);
+			VE_NULL_FUNCTION(glUniform1dv, PFNGLUNIFORM1DVPROC);
+			VE_NULL_FUNCTION(glUniform2dv, PFNGLUNIFORM2DVPROC);
+			VE_NULL_FUNCTION(glUniform3dv, PFNGLUNIFORM3DVPROC);
+			VE_NULL_FUNCTION(glUniform4dv, PFNGLUNIFORM4DVPROC);
+			VE_NULL_FUNCTION(glUniformMatrix2dv, PFNGLUNIFORMMATRIX2DVPROC);
+			VE_NULL_FUNCTION(glUniformMatrix3dv, PFNGLUNIFORMMATRIX3DVPROC);
+			VE_NULL_FUNCTION(glUniformMatrix4dv, PFNGLUNIFORMMATRIX4DVPROC);
+			VE_NULL_FUNCTION(glUniformMatrix2x3dv, PFNGLUNIFORMMATRIX2X3DVPROC);
+			VE_NULL_FUNCTION(glUniformMatrix2x4dv, PFNGLUNIFORMMATRIX2X4DVPROC);
+			VE_NULL_FUNCTION(glUniformMatrix3x2dv, PFNGLUNIFORMMATRIX3X2DVPROC);
+			VE_NULL_FUNCTION(glUniformMatrix3x4dv, PFNGLUNIFORMMATRIX3X4DVPROC);
+			VE_NULL_FUNCTION(glUniformMatrix4x2dv, PFNGLUNIFORMMATRIX4X2DVPROC);
+			VE_NULL_FUNCTION(glUniformMatrix4x3dv, PFNGLUNIFORMMATRIX4X3DVPROC);
+			VE_NULL_FUNCTION(glGetUniformdv, PFNGLGETUNIFORMDVPROC);
+			VE_NULL_FUNCTION(glGetSubroutineUniformLocation, PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC);
+			VE_NULL_FUNCTION(glGetSubroutineIndex, PFNGLGETSUBROUTINEINDEXPROC);
+			VE_NULL_FUNCTION(glGetActiveSubroutineUniformiv, PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC);
+			VE_NULL_FUNCTION(glGetActiveSubroutineUniformName, PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC);
+			VE_NULL_FUNCTION(glGetActiveSubroutineName, PFNGLGETACTIVESUBROUTINENAMEPROC);
+			VE_NULL_FUNCTION(glUniformSubroutinesuiv, PFNGLUNIFORMSUBROUTINESUIVPROC);
+			VE_NULL_FUNCTION(glGetUniformSubroutineuiv, PFNGLGETUNIFORMSUBROUTINEUIVPROC);
+			VE_NULL_FUNCTION(glGetProgramStageiv, PFNGLGETPROGRAMSTAGEIVPROC);
+			VE_NULL_FUNCTION(glPatchParameteri, PFNGLPATCHPARAMETERIPROC);
+			VE_NULL_FUNCTION(glPatchParameterfv, PFNGLPATCHPARAMETERFVPROC);
+			VE_NULL_FUNCTION(glBindTransformFeedback, PFNGLBINDTRANSFORMFEEDBACKPROC);
+			VE_NULL_FUNCTION(glDeleteTransformFeedbacks, PFNGLDELETETRANSFORMFEEDBACKSPROC);
+			VE_NULL_FUNCTION(glGenTransformFeedbacks, PFNGLGENTRANSFORMFEEDBACKSPROC);
+			VE_NULL_FUNCTION(glIsTransformFeedback, PFNGLISTRANSFORMFEEDBACKPROC);
+			VE_NULL_FUNCTION(glPauseTransformFeedback, PFNGLPAUSETRANSFORMFEEDBACKPROC);
+			VE_NULL_FUNCTION(glResumeTransformFeedback, PFNGLRESUMETRANSFORMFEEDBACKPROC);
+			VE_NULL_FUNCTION(glDrawTransformFeedback, PFNGLDRAWTRANSFORMFEEDBACKPROC);
+			VE_NULL_FUNCTION(glDrawTransformFeedbackStream, PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC);
+			VE_NULL_FUNCTION(glBeginQueryIndexed, PFNGLBEGINQUERYINDEXEDPROC);
+			VE_NULL_FUNCTION(glEndQueryIndexed, PFNGLENDQUERYINDEXEDPROC);
+			VE_NULL_FUNCTION(glGetQueryIndexediv, PFNGLGETQUERYINDEXEDIVPROC);
+			VE_NULL_FUNCTION(glReleaseShaderCompiler, PFNGLRELEASESHADERCOMPILERPROC);
+			VE_NULL_FUNCTION(glShaderBinary, PFNGLSHADERBINARYPROC);
+			VE_NULL_FUNCTION(glGetShaderPrecisionFormat, PFNGLGETSHADERPRECISIONFORMATPROC);
+			VE_NULL_FUNCTION(glDepthRangef, PFNGLDEPTHRANGEFPROC);
+			VE_NULL_FUNCTION(glClearDepthf, PFNGLCLEARDEPTHFPROC);
+			VE_NULL_FUNCTION(glGetProgramBinary, PFNGLGETPROGRAMBINARYPROC);
+			VE_NULL_FUNCTION(glProgramBinary, PFNGLPROGRAMBINARYPROC);
+			VE_NULL_FUNCTION(glProgramParameteri, PFNGLPROGRAMPARAMETERIPROC);
+			VE_NULL_FUNCTION(glUseProgramStages, PFNGLUSEPROGRAMSTAGESPROC);
+			VE_NULL_FUNCTION(glActiveShaderProgram, PFNGLACTIVESHADERPROGRAMPROC);
+			VE_NULL_FUNCTION(glCreateShaderProgramv, PFNGLCREATESHADERPROGRAMVPROC);
+			VE_NULL_FUNCTION(glBindProgramPipeline, PFNGLBINDPROGRAMPIPELINEPROC);
+			VE_NULL_FUNCTION(glDeleteProgramPipelines, PFNGLDELETEPROGRAMPIPELINESPROC);
+			VE_NULL_FUNCTION(glGenProgramPipelines, PFNGLGENPROGRAMPIPELINESPROC);
+			VE_NULL_FUNCTION(glIsProgramPipeline, PFNGLISPROGRAMPIPELINEPROC);
+			VE_NULL_FUNCTION(glGetProgramPipelineiv, PFNGLGETPROGRAMPIPELINEIVPROC);
+			VE_NULL_FUNCTION(glProgramUniform1i, PFNGLPROGRAMUNIFORM1IPROC);
+			VE_NULL_FUNCTION(glProgramUniform1iv, PFNGLPROGRAMUNIFORM1IVPROC);
+			VE_NULL_FUNCTION(glProgramUniform1f, PFNGLPROGRAMUNIFORM1FPROC);
+			VE_NULL_FUNCTION(glProgramUniform1fv, PFNGLPROGRAMUNIFORM1FVPROC);
+			VE_NULL_FUNCTION(glProgramUniform1d, PFNGLPROGRAMUNIFORM1DPROC);
+			VE_NULL_FUNCTION(glProgramUniform1dv, PFNGLPROGRAMUNIFORM1DVPROC);
+			VE_NULL_FUNCTION(glProgramUniform1ui, PFNGLPROGRAMUNIFORM1UIPROC);
+			VE_NULL_FUNCTION(glProgramUniform1uiv, PFNGLPROGRAMUNIFORM1UIVPROC);
+			VE_NULL_FUNCTION(glProgramUniform2i, PFNGLPROGRAMUNIFORM2IPROC);
+			VE_NULL_FUNCTION(glProgramUniform2iv, PFNGLPROGRAMUNIFORM2IVPROC);
+			VE_NULL_FUNCTION(glProgramUniform2f, PFNGLPROGRAMUNIFORM2FPROC);
+			VE_NULL_FUNCTION(glProgramUniform2fv, PFNGLPROGRAMUNIFORM2FVPROC);
+			VE_NULL_FUNCTION(glProgramUniform2d, PFNGLPROGRAMUNIFORM2DPROC);
+			VE_NULL_FUNCTION(glProgramUniform2dv, PFNGLPROGRAMUNIFORM2DVPROC);
+			VE_NULL_FUNCTION(glProgramUniform2ui, PFNGLPROGRAMUNIFORM2UIPROC);
+			VE_NULL_FUNCTION(glProgramUniform2uiv, PFNGLPROGRAMUNIFORM2UIVPROC);
+			VE_NULL_FUNCTION(glProgramUniform3i, PFNGLPROGRAMUNIFORM3IPROC);
+			VE_NULL_FUNCTION(glProgramUniform3iv, PFNGLPROGRAMUNIFORM3IVPROC);
+			VE_NULL_FUNCTION(glProgramUniform3f, PFNGLPROGRAMUNIFORM3FPROC);
+			VE_NULL_FUNCTION(glProgramUniform3fv, PFNGLPROGRAMUNIFORM3FVPROC);
+			VE_NULL_FUNCTION(glProgramUniform3d, PFNGLPROGRAMUNIFORM3DPROC);
+			VE_NULL_FUNCTION(glProgramUniform3dv, PFNGLPROGRAMUNIFORM3DVPROC);
+			VE_NULL_FUNCTION(glProgramUniform3ui, PFNGLPROGRAMUNIFORM3UIPROC);
+			VE_NULL_FUNCTION(glProgramUniform3uiv, PFNGLPROGRAMUNIFORM3UIVPROC);
+			VE_NULL_FUNCTION(glProgramUniform4i, PFNGLPROGRAMUNIFORM4IPROC);
+			VE_NULL_FUNCTION(glProgramUniform4iv, PFNGLPROGRAMUNIFORM4IVPROC);
+			VE_NULL_FUNCTION(glProgramUniform4f, PFNGLPROGRAMUNIFORM4FPROC);
+			VE_NULL_FUNCTION(glProgramUniform4fv, PFNGLPROGRAMUNIFORM4FVPROC);
+			VE_NULL_FUNCTION(glProgramUniform4d, PFNGLPROGRAMUNIFORM4DPROC);
+			VE_NULL_FUNCTION(glProgramUniform4dv, PFNGLPROGRAMUNIFORM4DVPROC);
+			VE_NULL_FUNCTION(glProgramUniform4ui, PFNGLPROGRAMUNIFORM4UIPROC);
+			VE_NULL_FUNCTION(glProgramUniform4uiv, PFNGLPROGRAMUNIFORM4UIVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix2fv, PFNGLPROGRAMUNIFORMMATRIX2FVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix3fv, PFNGLPROGRAMUNIFORMMATRIX3FVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix4fv, PFNGLPROGRAMUNIFORMMATRIX4FVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix2dv, PFNGLPROGRAMUNIFORMMATRIX2DVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix3dv, PFNGLPROGRAMUNIFORMMATRIX3DVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix4dv, PFNGLPROGRAMUNIFORMMATRIX4DVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix2x3fv, PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix3x2fv, PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix2x4fv, PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix4x2fv, PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix3x4fv, PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix4x3fv, PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix2x3dv, PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix3x2dv, PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix2x4dv, PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix4x2dv, PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix3x4dv, PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC);
+			VE_NULL_FUNCTION(glProgramUniformMatrix4x3dv, PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC);
+			VE_NULL_FUNCTION(glValidateProgramPipeline, PFNGLVALIDATEPROGRAMPIPELINEPROC);
+			VE_NULL_FUNCTION(glGetProgramPipelineInfoLog, PFNGLGETPROGRAMPIPELINEINFOLOGPROC);
+			VE_NULL_FUNCTION(glVertexAttribL1d, PFNGLVERTEXATTRIBL1DPROC);
+			VE_NULL_FUNCTION(glVertexAttribL2d, PFNGLVERTEXATTRIBL2DPROC);
+			VE_NULL_FUNCTION(glVertexAttribL3d, PFNGLVERTEXATTRIBL3DPROC);
+			VE_NULL_FUNCTION(glVertexAttribL4d, PFNGLVERTEXATTRIBL4DPROC);
+			VE_NULL_FUNCTION(glVertexAttribL1dv, PFNGLVERTEXATTRIBL1DVPROC);
+			VE_NULL_FUNCTION(glVertexAttribL2dv, PFNGLVERTEXATTRIBL2DVPROC);
+			VE_NULL_FUNCTION(glVertexAttribL3dv, PFNGLVERTEXATTRIBL3DVPROC);
+			VE_NULL_FUNCTION(glVertexAttribL4dv, PFNGLVERTEXATTRIBL4DVPROC);
+			VE_NULL_FUNCTION(glVertexAttribLPointer, PFNGLVERTEXATTRIBLPOINTERPROC);
+			VE_NULL_FUNCTION(glGetVertexAttribLdv, PFNGLGETVERTEXATTRIBLDVPROC);
+			VE_NULL_FUNCTION(glViewportArrayv, PFNGLVIEWPORTARRAYVPROC);
+			VE_NULL_FUNCTION(glViewportIndexedf, PFNGLVIEWPORTINDEXEDFPROC);
+			VE_NULL_FUNCTION(glViewportIndexedfv, PFNGLVIEWPORTINDEXEDFVPROC);
+			VE_NULL_FUNCTION(glScissorArrayv, PFNGLSCISSORARRAYVPROC);
+			VE_NULL_FUNCTION(glScissorIndexed, PFNGLSCISSORINDEXEDPROC);
+			VE_NULL_FUNCTION(glScissorIndexedv, PFNGLSCISSORINDEXEDVPROC);
+			VE_NULL_FUNCTION(glDepthRangeArrayv, PFNGLDEPTHRANGEARRAYVPROC);
+			VE_NULL_FUNCTION(glDepthRangeIndexed, PFNGLDEPTHRANGEINDEXEDPROC);
+			VE_NULL_FUNCTION(glGetFloati_v, PFNGLGETFLOATI_VPROC);
+			VE_NULL_FUNCTION(glGetDoublei_v, PFNGLGETDOUBLEI_VPROC);
+			VE_NULL_FUNCTION(glDrawArraysInstancedBaseInstance, PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC);
+			VE_NULL_FUNCTION(glDrawElementsInstancedBaseInstance, PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC);
+			VE_NULL_FUNCTION(glDrawElementsInstancedBaseVertexBaseInstance, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC);
+			VE_NULL_FUNCTION(glGetformativ, PFNGLGETINTERNALFORMATIVPROC);
+			VE_NULL_FUNCTION(glGetActiveAtomicCounterBufferiv, PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC);
+			VE_NULL_FUNCTION(glBindImageTexture, PFNGLBINDIMAGETEXTUREPROC);
+			VE_NULL_FUNCTION(glMemoryBarrier, PFNGLMEMORYBARRIERPROC);
+			VE_NULL_FUNCTION(glTexStorage1D, PFNGLTEXSTORAGE1DPROC);
+			VE_NULL_FUNCTION(glTexStorage2D, PFNGLTEXSTORAGE2DPROC);
+			VE_NULL_FUNCTION(glTexStorage3D, PFNGLTEXSTORAGE3DPROC);
+			VE_NULL_FUNCTION(glDrawTransformFeedbackInstanced, PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC);
+			VE_NULL_FUNCTION(glDrawTransformFeedbackStreamInstanced, PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC);
+			VE_NULL_FUNCTION(glClearBufferData, PFNGLCLEARBUFFERDATAPROC);
+			VE_NULL_FUNCTION(glClearBufferSubData, PFNGLCLEARBUFFERSUBDATAPROC);
+			VE_NULL_FUNCTION(glDispatchCompute, PFNGLDISPATCHCOMPUTEPROC);
+			VE_NULL_FUNCTION(glDispatchComputeIndirect, PFNGLDISPATCHCOMPUTEINDIRECTPROC);
+			VE_NULL_FUNCTION(glCopyImageSubData, PFNGLCOPYIMAGESUBDATAPROC);
+			VE_NULL_FUNCTION(glFramebufferParameteri, PFNGLFRAMEBUFFERPARAMETERIPROC);
+			VE_NULL_FUNCTION(glGetFramebufferParameteriv, PFNGLGETFRAMEBUFFERPARAMETERIVPROC);
+			VE_NULL_FUNCTION(glGetformati64v, PFNGLGETINTERNALFORMATI64VPROC);
+			VE_NULL_FUNCTION(glInvalidateTexSubImage, PFNGLINVALIDATETEXSUBIMAGEPROC);
+			VE_NULL_FUNCTION(glInvalidateTexImage, PFNGLINVALIDATETEXIMAGEPROC);
+			VE_NULL_FUNCTION(glInvalidateBufferSubData, PFNGLINVALIDATEBUFFERSUBDATAPROC);
+			VE_NULL_FUNCTION(glInvalidateBufferData, PFNGLINVALIDATEBUFFERDATAPROC);
+			VE_NULL_FUNCTION(glInvalidateFramebuffer, PFNGLINVALIDATEFRAMEBUFFERPROC);
+			VE_NULL_FUNCTION(glInvalidateSubFramebuffer, PFNGLINVALIDATESUBFRAMEBUFFERPROC);
+			VE_NULL_FUNCTION(glMultiDrawArraysIndirect, PFNGLMULTIDRAWARRAYSINDIRECTPROC);
+			VE_NULL_FUNCTION(glMultiDrawElementsIndirect, PFNGLMULTIDRAWELEMENTSINDIRECTPROC);
+			VE_NULL_FUNCTION(glGetProgramInterfaceiv, PFNGLGETPROGRAMINTERFACEIVPROC);
+			VE_NULL_FUNCTION(glGetProgramResourceIndex, PFNGLGETPROGRAMRESOURCEINDEXPROC);
+			VE_NULL_FUNCTION(glGetProgramResourceName, PFNGLGETPROGRAMRESOURCENAMEPROC);
+			VE_NULL_FUNCTION(glGetProgramResourceiv, PFNGLGETPROGRAMRESOURCEIVPROC);
+			VE_NULL_FUNCTION(glGetProgramResourceLocation, PFNGLGETPROGRAMRESOURCELOCATIONPROC);
+			VE_NULL_FUNCTION(glGetProgramResourceLocationIndex, PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC);
+			VE_NULL_FUNCTION(glShaderStorageBlockBinding, PFNGLSHADERSTORAGEBLOCKBINDINGPROC);
+			VE_NULL_FUNCTION(glTexBufferRange, PFNGLTEXBUFFERRANGEPROC);
+			VE_NULL_FUNCTION(glTexStorage2DMultisample, PFNGLTEXSTORAGE2DMULTISAMPLEPROC);
+			VE_NULL_FUNCTION(glTexStorage3DMultisample, PFNGLTEXSTORAGE3DMULTISAMPLEPROC);
+			VE_NULL_FUNCTION(glTextureView, PFNGLTEXTUREVIEWPROC);
+			VE_NULL_FUNCTION(glBindVertexBuffer, PFNGLBINDVERTEXBUFFERPROC);
+			VE_NULL_FUNCTION(glVertexAttribFormat, PFNGLVERTEXATTRIBFORMATPROC);
+			VE_NULL_FUNCTION(glVertexAttribIFormat, PFNGLVERTEXATTRIBIFORMATPROC);
+			VE_NULL_FUNCTION(glVertexAttribLFormat, PFNGLVERTEXATTRIBLFORMATPROC);
+			VE_NULL_FUNCTION(glVertexAttribBinding, PFNGLVERTEXATTRIBBINDINGPROC);
+			VE_NULL_FUNCTION(glVertexBindingDivisor, PFNGLVERTEXBINDINGDIVISORPROC);
+			VE_NULL_FUNCTION(glDebugMessageControl, PFNGLDEBUGMESSAGECONTROLPROC);
+			VE_NULL_FUNCTION(glDebugMessageInsert, PFNGLDEBUGMESSAGEINSERTPROC);
+			VE_NULL_FUNCTION(glDebugMessageCallback, PFNGLDEBUGMESSAGECALLBACKPROC);
+			VE_NULL_FUNCTION(glGetDebugMessageLog, PFNGLGETDEBUGMESSAGELOGPROC);
+			VE_NULL_FUNCTION(glPushDebugGroup, PFNGLPUSHDEBUGGROUPPROC);
+			VE_NULL_FUNCTION(glPopDebugGroup, PFNGLPOPDEBUGGROUPPROC);
+			VE_NULL_FUNCTION(glObjectLabel, PFNGLOBJECTLABELPROC);
+			VE_NULL_FUNCTION(glGetObjectLabel, PFNGLGETOBJECTLABELPROC);
+			VE_NULL_FUNCTION(glObjectPtrLabel, PFNGLOBJECTPTRLABELPROC);
+			VE_NULL_FUNCTION(glGetObjectPtrLabel, PFNGLGETOBJECTPTRLABELPROC);
+			VE_NULL_FUNCTION(glBufferStorage, PFNGLBUFFERSTORAGEPROC);
+			VE_NULL_FUNCTION(glClearTexImage, PFNGLCLEARTEXIMAGEPROC);
+			VE_NULL_FUNCTION(glClearTexSubImage, PFNGLCLEARTEXSUBIMAGEPROC);
+			VE_NULL_FUNCTION(glBindBuffersBase, PFNGLBINDBUFFERSBASEPROC);
+			VE_NULL_FUNCTION(glBindBuffersRange, PFNGLBINDBUFFERSRANGEPROC);
+			VE_NULL_FUNCTION(glBindTextures, PFNGLBINDTEXTURESPROC);
+			VE_NULL_FUNCTION(glBindSamplers, PFNGLBINDSAMPLERSPROC);
+			VE_NULL_FUNCTION(glBindImageTextures, PFNGLBINDIMAGETEXTURESPROC);
+			VE_NULL_FUNCTION(glBindVertexBuffers, PFNGLBINDVERTEXBUFFERSPROC);
+			VE_NULL_FUNCTION(glClipControl, PFNGLCLIPCONTROLPROC);
+			VE_NULL_FUNCTION(glCreateTransformFeedbacks, PFNGLCREATETRANSFORMFEEDBACKSPROC);
+			VE_NULL_FUNCTION(glTransformFeedbackBufferBase, PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC);
+			VE_NULL_FUNCTION(glTransformFeedbackBufferRange, PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC);
+			VE_NULL_FUNCTION(glGetTransformFeedbackiv, PFNGLGETTRANSFORMFEEDBACKIVPROC);
+			VE_NULL_FUNCTION(glGetTransformFeedbacki_v, PFNGLGETTRANSFORMFEEDBACKI_VPROC);
+			VE_NULL_FUNCTION(glGetTransformFeedbacki64_v, PFNGLGETTRANSFORMFEEDBACKI64_VPROC);
+			VE_NULL_FUNCTION(glCreateBuffers, PFNGLCREATEBUFFERSPROC);
+			VE_NULL_FUNCTION(glNamedBufferStorage, PFNGLNAMEDBUFFERSTORAGEPROC);
+			VE_NULL_FUNCTION(glNamedBufferData, PFNGLNAMEDBUFFERDATAPROC);
+			VE_NULL_FUNCTION(glNamedBufferSubData, PFNGLNAMEDBUFFERSUBDATAPROC);
+			VE_NULL_FUNCTION(glCopyNamedBufferSubData, PFNGLCOPYNAMEDBUFFERSUBDATAPROC);
+			VE_NULL_FUNCTION(glClearNamedBufferData, PFNGLCLEARNAMEDBUFFERDATAPROC);
+			VE_NULL_FUNCTION(glClearNamedBufferSubData, PFNGLCLEARNAMEDBUFFERSUBDATAPROC);
+			VE_NULL_FUNCTION(glMapNamedBuffer, PFNGLMAPNAMEDBUFFERPROC);
+			VE_NULL_FUNCTION(glMapNamedBufferRange, PFNGLMAPNAMEDBUFFERRANGEPROC);
+			VE_NULL_FUNCTION(glUnmapNamedBuffer, PFNGLUNMAPNAMEDBUFFERPROC);
+			VE_NULL_FUNCTION(glFlushMappedNamedBufferRange, PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC);
+			VE_NULL_FUNCTION(glGetNamedBufferParameteriv, PFNGLGETNAMEDBUFFERPARAMETERIVPROC);
+			VE_NULL_FUNCTION(glGetNamedBufferParameteri64v, PFNGLGETNAMEDBUFFERPARAMETERI64VPROC);
+			VE_NULL_FUNCTION(glGetNamedBufferPointerv, PFNGLGETNAMEDBUFFERPOINTERVPROC);
+			VE_NULL_FUNCTION(glGetNamedBufferSubData, PFNGLGETNAMEDBUFFERSUBDATAPROC);
+			VE_NULL_FUNCTION(glCreateFramebuffers, PFNGLCREATEFRAMEBUFFERSPROC);
+			VE_NULL_FUNCTION(glNamedFramebufferRenderbuffer, PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC);
+			VE_NULL_FUNCTION(glNamedFramebufferParameteri, PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC);
+			VE_NULL_FUNCTION(glNamedFramebufferTexture, PFNGLNAMEDFRAMEBUFFERTEXTUREPROC);
+			VE_NULL_FUNCTION(glNamedFramebufferTextureLayer, PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC);
+			VE_NULL_FUNCTION(glNamedFramebufferDrawBuffer, PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC);
+			VE_NULL_FUNCTION(glNamedFramebufferDrawBuffers, PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC);
+			VE_NULL_FUNCTION(glNamedFramebufferReadBuffer, PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC);
+			VE_NULL_FUNCTION(glInvalidateNamedFramebufferData, PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC);
+			VE_NULL_FUNCTION(glInvalidateNamedFramebufferSubData, PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC);
+			VE_NULL_FUNCTION(glClearNamedFramebufferiv, PFNGLCLEARNAMEDFRAMEBUFFERIVPROC);
+			VE_NULL_FUNCTION(glClearNamedFramebufferuiv, PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC);
+			VE_NULL_FUNCTION(glClearNamedFramebufferfv, PFNGLCLEARNAMEDFRAMEBUFFERFVPROC);
+			VE_NULL_FUNCTION(glClearNamedFramebufferfi, PFNGLCLEARNAMEDFRAMEBUFFERFIPROC);
+			VE_NULL_FUNCTION(glBlitNamedFramebuffer, PFNGLBLITNAMEDFRAMEBUFFERPROC);
+			VE_NULL_FUNCTION(glCheckNamedFramebufferStatus, PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC);
+			VE_NULL_FUNCTION(glGetNamedFramebufferParameteriv, PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC);
+			VE_NULL_FUNCTION(glGetNamedFramebufferAttachmentParameteriv, PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC);
+			VE_NULL_FUNCTION(glCreateRenderbuffers, PFNGLCREATERENDERBUFFERSPROC);
+			VE_NULL_FUNCTION(glNamedRenderbufferStorage, PFNGLNAMEDRENDERBUFFERSTORAGEPROC);
+			VE_NULL_FUNCTION(glNamedRenderbufferStorageMultisample, PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC);
+			VE_NULL_FUNCTION(glGetNamedRenderbufferParameteriv, PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC);
+			VE_NULL_FUNCTION(glCreateTextures, PFNGLCREATETEXTURESPROC);
+			VE_NULL_FUNCTION(glTextureBuffer, PFNGLTEXTUREBUFFERPROC);
+			VE_NULL_FUNCTION(glTextureBufferRange, PFNGLTEXTUREBUFFERRANGEPROC);
+			VE_NULL_FUNCTION(glTextureStorage1D, PFNGLTEXTURESTORAGE1DPROC);
+			VE_NULL_FUNCTION(glTextureStorage2D, PFNGLTEXTURESTORAGE2DPROC);
+			VE_NULL_FUNCTION(glTextureStorage3D, PFNGLTEXTURESTORAGE3DPROC);
+			VE_NULL_FUNCTION(glTextureStorage2DMultisample, PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC);
+			VE_NULL_FUNCTION(glTextureStorage3DMultisample, PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC);
+			VE_NULL_FUNCTION(glTextureSubImage1D, PFNGLTEXTURESUBIMAGE1DPROC);
+			VE_NULL_FUNCTION(glTextureSubImage2D, PFNGLTEXTURESUBIMAGE2DPROC);
+			VE_NULL_FUNCTION(glTextureSubImage3D, PFNGLTEXTURESUBIMAGE3DPROC);
+			VE_NULL_FUNCTION(glCompressedTextureSubImage1D, PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC);
+			VE_NULL_FUNCTION(glCompressedTextureSubImage2D, PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC);
+			VE_NULL_FUNCTION(glCompressedTextureSubImage3D, PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC);
+			VE_NULL_FUNCTION(glCopyTextureSubImage1D, PFNGLCOPYTEXTURESUBIMAGE1DPROC);
+			VE_NULL_FUNCTION(glCopyTextureSubImage2D, PFNGLCOPYTEXTURESUBIMAGE2DPROC);
+			VE_NULL_FUNCTION(glCopyTextureSubImage3D, PFNGLCOPYTEXTURESUBIMAGE3DPROC);
+			VE_NULL_FUNCTION(glTextureParameterf, PFNGLTEXTUREPARAMETERFPROC);
+			VE_NULL_FUNCTION(glTextureParameterfv, PFNGLTEXTUREPARAMETERFVPROC);
+			VE_NULL_FUNCTION(glTextureParameteri, PFNGLTEXTUREPARAMETERIPROC);
+			VE_NULL_FUNCTION(glTextureParameterIiv, PFNGLTEXTUREPARAMETERIIVPROC);
+			VE_NULL_FUNCTION(glTextureParameterIuiv, PFNGLTEXTUREPARAMETERIUIVPROC);
+			VE_NULL_FUNCTION(glTextureParameteriv, PFNGLTEXTUREPARAMETERIVPROC);
+			VE_NULL_FUNCTION(glGenerateTextureMipmap, PFNGLGENERATETEXTUREMIPMAPPROC);
+			VE_NULL_FUNCTION(glBindTextureUnit, PFNGLBINDTEXTUREUNITPROC);
+			VE_NULL_FUNCTION(glGetTextureImage, PFNGLGETTEXTUREIMAGEPROC);
+			VE_NULL_FUNCTION(glGetCompressedTextureImage, PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC);
+			VE_NULL_FUNCTION(glGetTextureLevelParameterfv, PFNGLGETTEXTURELEVELPARAMETERFVPROC);
+			VE_NULL_FUNCTION(glGetTextureLevelParameteriv, PFNGLGETTEXTURELEVELPARAMETERIVPROC);
+			VE_NULL_FUNCTION(glGetTextureParameterfv, PFNGLGETTEXTUREPARAMETERFVPROC);
+			VE_NULL_FUNCTION(glGetTextureParameterIiv, PFNGLGETTEXTUREPARAMETERIIVPROC);
+			VE_NULL_FUNCTION(glGetTextureParameterIuiv, PFNGLGETTEXTUREPARAMETERIUIVPROC);
+			VE_NULL_FUNCTION(glGetTextureParameteriv, PFNGLGETTEXTUREPARAMETERIVPROC);
+			VE_NULL_FUNCTION(glCreateVertexArrays, PFNGLCREATEVERTEXARRAYSPROC);
+			VE_NULL_FUNCTION(glDisableVertexArrayAttrib, PFNGLDISABLEVERTEXARRAYATTRIBPROC);
+			VE_NULL_FUNCTION(glEnableVertexArrayAttrib, PFNGLENABLEVERTEXARRAYATTRIBPROC);
+			VE_NULL_FUNCTION(glVertexArrayElementBuffer, PFNGLVERTEXARRAYELEMENTBUFFERPROC);
+			VE_NULL_FUNCTION(glVertexArrayVertexBuffer, PFNGLVERTEXARRAYVERTEXBUFFERPROC);
+			VE_NULL_FUNCTION(glVertexArrayVertexBuffers, PFNGLVERTEXARRAYVERTEXBUFFERSPROC);
+			VE_NULL_FUNCTION(glVertexArrayAttribBinding, PFNGLVERTEXARRAYATTRIBBINDINGPROC);
+			VE_NULL_FUNCTION(glVertexArrayAttribFormat, PFNGLVERTEXARRAYATTRIBFORMATPROC);
+			VE_NULL_FUNCTION(glVertexArrayAttribIFormat, PFNGLVERTEXARRAYATTRIBIFORMATPROC);
+			VE_NULL_FUNCTION(glVertexArrayAttribLFormat, PFNGLVERTEXARRAYATTRIBLFORMATPROC);
+			VE_NULL_FUNCTION(glVertexArrayBindingDivisor, PFNGLVERTEXARRAYBINDINGDIVISORPROC);
+			VE_NULL_FUNCTION(glGetVertexArrayiv, PFNGLGETVERTEXARRAYIVPROC);
+			VE_NULL_FUNCTION(glGetVertexArrayIndexediv, PFNGLGETVERTEXARRAYINDEXEDIVPROC);
+			VE_NULL_FUNCTION(glGetVertexArrayIndexed64iv, PFNGLGETVERTEXARRAYINDEXED64IVPROC);
+			VE_NULL_FUNCTION(glCreateSamplers, PFNGLCREATESAMPLERSPROC);
+			VE_NULL_FUNCTION(glCreateProgramPipelines, PFNGLCREATEPROGRAMPIPELINESPROC);
+			VE_NULL_FUNCTION(glCreateQueries, PFNGLCREATEQUERIESPROC);
+			VE_NULL_FUNCTION(glGetQueryBufferObjecti64v, PFNGLGETQUERYBUFFEROBJECTI64VPROC);
+			VE_NULL_FUNCTION(glGetQueryBufferObjectiv, PFNGLGETQUERYBUFFEROBJECTIVPROC);
+			VE_NULL_FUNCTION(glGetQueryBufferObjectui64v, PFNGLGETQUERYBUFFEROBJECTUI64VPROC);
+			VE_NULL_FUNCTION(glGetQueryBufferObjectuiv, PFNGLGETQUERYBUFFEROBJECTUIVPROC);
+			VE_NULL_FUNCTION(glMemoryBarrierByRegion, PFNGLMEMORYBARRIERBYREGIONPROC);
+			VE_NULL_FUNCTION(glGetTextureSubImage, PFNGLGETTEXTURESUBIMAGEPROC);
+			VE_NULL_FUNCTION(glGetCompressedTextureSubImage, PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC);
+			VE_NULL_FUNCTION(glGetGraphicsResetStatus, PFNGLGETGRAPHICSRESETSTATUSPROC);
+			VE_NULL_FUNCTION(glGetnCompressedTexImage, PFNGLGETNCOMPRESSEDTEXIMAGEPROC);
+			VE_NULL_FUNCTION(glGetnTexImage, PFNGLGETNTEXIMAGEPROC);
+			VE_NULL_FUNCTION(glGetnUniformdv, PFNGLGETNUNIFORMDVPROC);
+			VE_NULL_FUNCTION(glGetnUniformfv, PFNGLGETNUNIFORMFVPROC);
+			VE_NULL_FUNCTION(glGetnUniformiv, PFNGLGETNUNIFORMIVPROC);
+			VE_NULL_FUNCTION(glGetnUniformuiv, PFNGLGETNUNIFORMUIVPROC);
+			VE_NULL_FUNCTION(glReadnPixels, PFNGLREADNPIXELSPROC);
+			VE_NULL_FUNCTION(glTextureBarrier, PFNGLTEXTUREBARRIERPROC);
+			VE_NULL_FUNCTION(glGetTextureHandleARB, PFNGLGETTEXTUREHANDLEARBPROC);
+			VE_NULL_FUNCTION(glGetTextureSamplerHandleARB, PFNGLGETTEXTURESAMPLERHANDLEARBPROC);
+			VE_NULL_FUNCTION(glMakeTextureHandleResidentARB, PFNGLMAKETEXTUREHANDLERESIDENTARBPROC);
+			VE_NULL_FUNCTION(glMakeTextureHandleNonResidentARB, PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC);
+			VE_NULL_FUNCTION(glGetImageHandleARB, PFNGLGETIMAGEHANDLEARBPROC);
+			VE_NULL_FUNCTION(glMakeImageHandleResidentARB, PFNGLMAKEIMAGEHANDLERESIDENTARBPROC);
+			VE_NULL_FUNCTION(glMakeImageHandleNonResidentARB, PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC);
+			VE_NULL_FUNCTION(glUniformHandleui64ARB, PFNGLUNIFORMHANDLEUI64ARBPROC);
+			VE_NULL_FUNCTION(glUniformHandleui64vARB, PFNGLUNIFORMHANDLEUI64VARBPROC);
+			VE_NULL_FUNCTION(glProgramUniformHandleui64ARB, PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC);
+			VE_NULL_FUNCTION(glProgramUniformHandleui64vARB, PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC);
+			VE_NULL_FUNCTION(glIsTextureHandleResidentARB, PFNGLISTEXTUREHANDLERESIDENTARBPROC);
+			VE_NULL_FUNCTION(glIsImageHandleResidentARB, PFNGLISIMAGEHANDLERESIDENTARBPROC);
+			VE_NULL_FUNCTION(glVertexAttribL1ui64ARB, PFNGLVERTEXATTRIBL1UI64ARBPROC);
+			VE_NULL_FUNCTION(glVertexAttribL1ui64vARB, PFNGLVERTEXATTRIBL1UI64VARBPROC);
+			VE_NULL_FUNCTION(glGetVertexAttribLui64vARB, PFNGLGETVERTEXATTRIBLUI64VARBPROC);
+			VE_NULL_FUNCTION(glCreateSyncFromCLeventARB, PFNGLCREATESYNCFROMCLEVENTARBPROC);
+			VE_NULL_FUNCTION(glDispatchComputeGroupSizeARB, PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC);
+			VE_NULL_FUNCTION(glDebugMessageControlARB, PFNGLDEBUGMESSAGECONTROLARBPROC);
+			VE_NULL_FUNCTION(glDebugMessageInsertARB, PFNGLDEBUGMESSAGEINSERTARBPROC);
+			VE_NULL_FUNCTION(glDebugMessageCallbackARB, PFNGLDEBUGMESSAGECALLBACKARBPROC);
+			VE_NULL_FUNCTION(glGetDebugMessageLogARB, PFNGLGETDEBUGMESSAGELOGARBPROC);
+			VE_NULL_FUNCTION(glBlendEquationiARB, PFNGLBLENDEQUATIONIARBPROC);
+			VE_NULL_FUNCTION(glBlendEquationSeparateiARB, PFNGLBLENDEQUATIONSEPARATEIARBPROC);
+			VE_NULL_FUNCTION(glBlendFunciARB, PFNGLBLENDFUNCIARBPROC);
+			VE_NULL_FUNCTION(glBlendFuncSeparateiARB, PFNGLBLENDFUNCSEPARATEIARBPROC);
+			VE_NULL_FUNCTION(glMultiDrawArraysIndirectCountARB, PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC);
+			VE_NULL_FUNCTION(glMultiDrawElementsIndirectCountARB, PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC);
+			VE_NULL_FUNCTION(glGetGraphicsResetStatusARB, PFNGLGETGRAPHICSRESETSTATUSARBPROC);
+			VE_NULL_FUNCTION(glGetnTexImageARB, PFNGLGETNTEXIMAGEARBPROC);
+			VE_NULL_FUNCTION(glReadnPixelsARB, PFNGLREADNPIXELSARBPROC);
+			VE_NULL_FUNCTION(glGetnCompressedTexImageARB, PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC);
+			VE_NULL_FUNCTION(glGetnUniformfvARB, PFNGLGETNUNIFORMFVARBPROC);
+			VE_NULL_FUNCTION(glGetnUniformivARB, PFNGLGETNUNIFORMIVARBPROC);
+			VE_NULL_FUNCTION(glGetnUniformuivARB, PFNGLGETNUNIFORMUIVARBPROC);
+			VE_NULL_FUNCTION(glGetnUniformdvARB, PFNGLGETNUNIFORMDVARBPROC);
+			VE_NULL_FUNCTION(glMinSampleShadingARB, PFNGLMINSAMPLESHADINGARBPROC);
+			VE_NULL_FUNCTION(glNamedStringARB, PFNGLNAMEDSTRINGARBPROC);
+			VE_NULL_FUNCTION(glDeleteNamedStringARB, PFNGLDELETENAMEDSTRINGARBPROC);
+			VE_NULL_FUNCTION(glCompileShaderIncludeARB, PFNGLCOMPILESHADERINCLUDEARBPROC);
+			VE_NULL_FUNCTION(glIsNamedStringARB, PFNGLISNAMEDSTRINGARBPROC);
+			VE_NULL_FUNCTION(glGetNamedStringARB, PFNGLGETNAMEDSTRINGARBPROC);
+			VE_NULL_FUNCTION(glGetNamedStringivARB, PFNGLGETNAMEDSTRINGIVARBPROC);
+			VE_NULL_FUNCTION(glBufferPageCommitmentARB, PFNGLBUFFERPAGECOMMITMENTARBPROC);
+			VE_NULL_FUNCTION(glNamedBufferPageCommitmentEXT, PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC);
+			VE_NULL_FUNCTION(glNamedBufferPageCommitmentARB, PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC);
+			VE_NULL_FUNCTION(glTexPageCommitmentARB, PFNGLTEXPAGECOMMITMENTARBPROC);
+#undef VE_NULL_FUNCTION
+
+			// The functions that record more than their calls.
+			glGenBuffers = nullGenBuffers;
+			glGenTextures = nullGenTextures;
+			glGenVertexArrays = nullGenVertexArrays;
+			glGenFramebuffers = nullGenFramebuffers;
+			glGenRenderbuffers = nullGenRenderbuffers;
+			glCreateProgram = nullCreateProgram;
+			glCreateShader = nullCreateShader;
+			glDeleteProgram = nullDeleteProgram;
+			glDeleteShader = nullDeleteShader;
+			glShaderSource = nullShaderSource;
+			glAttachShader = nullAttachShader;
+			glLinkProgram = nullLinkProgram;
+			glGetShaderiv = nullGetShaderiv;
+			glGetProgramiv = nullGetProgramiv;
+			glGetActiveUniform = nullGetActiveUniform;
+			glGetActiveAttrib = nullGetActiveAttrib;
+			glGetActiveUniformBlockName = nullGetActiveUniformBlockName;
+			glGetIntegerv = nullGetIntegerv;
+			glGetString = nullGetString;
+			glGetAttribLocation = nullGetAttribLocation;
+			glGetUniformLocation = nullGetUniformLocation;
+			glGetUniformBlockIndex = nullGetUniformBlockIndex;
+			glCheckFramebufferStatus = nullCheckFramebufferStatus;
+			glUseProgram = nullUseProgram;
+			glBindVertexArray = nullBindVertexArray;
+			glBindFramebuffer = nullBindFramebuffer;
+			glActiveTexture = nullActiveTexture;
+			glBindBuffer = nullBindBuffer;
+			glBindBufferBase = nullBindBufferBase;
+			glBindTexture = nullBindTexture;
+			glBufferData = nullBufferData;
+			glBufferSubData = nullBufferSubData;
+			glTexImage2D = nullTexImage2D;
+			glTexSubImage2D = nullTexSubImage2D;
+			glDrawArrays = nullDrawArrays;
+			glDrawElements = nullDrawElements;
+			glDrawArraysInstanced = nullDrawArraysInstanced;
+			glDrawElementsInstanced = nullDrawElementsInstanced;
+			glUniform1i = nullUniform1i;
+			glUniform1f = nullUniform1f;
+			glUniform2iv = nullUniform2iv;
+			glUniform3iv = nullUniform3iv;
+			glUniform4iv = nullUniform4iv;
+			glUniform2fv = nullUniform2fv;
+			glUniform3fv = nullUniform3fv;
+			glUniform4fv = nullUniform4fv;
+			glUniformMatrix2fv = nullUniformMatrix2fv;
+			glUniformMatrix3fv = nullUniformMatrix3fv;
+			glUniformMatrix4fv = nullUniformMatrix4fv;
+		}
+	}
+}
\ No newline at end of file
@@ -1,11 +1,14 @@
 #include "render/scene.hpp"
-#include <set>
-#include <algorithm>
+#include <cassert>
 
 namespace ve
 {
 	namespace render
 	{
+		// Scratch space for recording, per thread since targets sharing a scene may record it at the same time.
+		thread_local std::vector<uint8_t> modelsVisible; // The culling results, parallel to the models.
+		thread_local std::vector<Matrix44f> instanceTransforms; // The transforms of the visible models of the batch being recorded.
+
 		void Scene::addDependentTarget(Ptr<Target> target)
 		{
 			dependentTargets.insert(target);
@@ -23,38 +26,215 @@ namespace ve
 
 		Ptr<Model> Scene::createModel()
 		{
-			return *models.insert(std::move(OwnPtr<Model>::returnNew())).first;
+			OwnPtr<Model> model = OwnPtr<Model>::returnNew(this);
+			model->setSceneIndex((unsigned int)models.size());
+			models.push_back(std::move(model));
+			modelBoundingSpheres.push_back({0, 0, 0, -1});
+			renderQueueNeedsSort = true;
+			markChanged();
+			return models.back();
 		}
 
 		void Scene::destroyModel(Ptr<Model> model)
 		{
-			auto it = std::find(models.begin(), models.end(), model);
-			if (it == models.end())
+			unsigned int index = model->getSceneIndex();
+			if (index >= models.size() || !(models[index] == model))
 			{
 				assert(false);
-				throw std::runtime_error("WHAT");
+				throw std::runtime_error("The model is not in this scene.");
 			}
-			else
+			if (index != models.size() - 1)
 			{
-				models.erase(it);
+				std::swap(models[index], models.back());
+				models[index]->setSceneIndex(index);
+				modelBoundingSpheres[index] = modelBoundingSpheres.back();
 			}
+			models.pop_back();
+			modelBoundingSpheres.pop_back();
+			renderQueueNeedsSort = true; // the render queue still points to the destroyed model
+			markChanged();
 		}
 
 		void Scene::setUniformsFunction(std::function<void(Ptr<Shader> const &)> const & uniformsFunction_)
 		{
 			uniformsFunction = uniformsFunction_;
+			markChanged();
+		}
+
+		void Scene::setUniformBuffer(Ptr<UniformBuffer> const & uniformBuffer)
+		{
+			markChanged();
+			for (auto && existing : uniformBuffers)
+			{
+				if (existing.isValid() && existing->getBindingPoint() == uniformBuffer->getBindingPoint())
+				{
+					existing = uniformBuffer;
+					return;
+				}
+			}
+			uniformBuffers.push_back(uniformBuffer);
+		}
+
+		void Scene::markChanged()
+		{
+			// Many threads may mark the scene as they move its models, so it is only written when it isn't already set.
+			if (!changed.load(std::memory_order_relaxed))
+			{
+				changed.store(true, std::memory_order_relaxed);
+			}
+		}
+
+		unsigned int Scene::getChangeCount() const
+		{
+			if (changed.exchange(false, std::memory_order_relaxed))
+			{
+				changeCount++;
+			}
+			unsigned int count = changeCount;
+			for (auto && uniformBuffer : uniformBuffers)
+			{
+				if (uniformBuffer.isValid())
+				{
+					count += uniformBuffer->getChangeCount();
+				}
+			}
+			return count;
+		}
+
+		void Scene::prepare()
+		{
+			if (renderQueueNeedsSort)
+			{
+				sortRenderQueue();
+				updateInstanceBatches();
+				renderQueueNeedsSort = false;
+			}
+		}
+
+		void Scene::record(CommandList & commands, std::function<void(Ptr<Shader> const &)> const & stageUniformsFunction, bool flipY, Frustum const * frustum) const
+		{
+			for (auto && uniformBuffer : uniformBuffers)
+			{
+				if (uniformBuffer.isValid())
+				{
+					commands.bindUniformBuffer(uniformBuffer.raw());
+				}
+			}
+			if (frustum != nullptr)
+			{
+				// Test all of the bounding spheres at once, before touching any model.
+				modelsVisible.resize(models.size());
+				frustum->intersects(modelBoundingSpheres.data(), modelsVisible.data(), (unsigned int)models.size());
+			}
+			unsigned int nextBatch = 0;
+			for (unsigned int i = 0; i < renderQueue.size(); i++)
+			{
+				if (nextBatch < instanceBatches.size() && instanceBatches[nextBatch].begin == i)
+				{
+					// Gather the transforms of the visible models of the batch and draw them with the state of the first.
+					InstanceBatch const & batch = instanceBatches[nextBatch];
+					instanceTransforms.clear();
+					for (unsigned int j = batch.begin; j < batch.end; j++)
+					{
+						if (frustum == nullptr || modelsVisible[renderQueue[j].sceneIndex] != 0)
+						{
+							instanceTransforms.push_back(renderQueue[j].model->getInstanceTransform());
+						}
+					}
+					renderQueue[batch.begin].model->recordInstances(commands, stageUniformsFunction, uniformsFunction, flipY, instanceTransforms.data(), (unsigned int)instanceTransforms.size());
+					i = batch.end - 1;
+					nextBatch++;
+					continue;
+				}
+				RenderQueueEntry const & entry = renderQueue[i];
+				if (frustum != nullptr && modelsVisible[entry.sceneIndex] == 0)
+				{
+					continue;
+				}
+				entry.model->record(commands, stageUniformsFunction, uniformsFunction, flipY);
+			}
+		}
+
+		void Scene::onModelSortKeyChanged()
+		{
+			renderQueueNeedsSort = true;
+			markChanged();
+		}
+
+		void Scene::onModelBatchChanged()
+		{
+			renderQueueNeedsSort = true;
+			markChanged();
 		}
 
-		void Scene::render(std::function<void(Ptr<Shader> const &)> const & stageUniformsFunction, bool flipY)
+		Sphere3f Scene::getModelBoundingSphere(unsigned int sceneIndex) const
 		{
-			std::set<Ptr<Model>> modelsSorted;
-			for (auto && model : models)
+			Vector4f const & sphere = modelBoundingSpheres[sceneIndex];
+			return Sphere3f(Vector3f {sphere[0], sphere[1], sphere[2]}, sphere[3]);
+		}
+
+		void Scene::setModelBoundingSphere(unsigned int sceneIndex, Sphere3f const & sphere)
+		{
+			modelBoundingSpheres[sceneIndex] = {sphere.center[0], sphere.center[1], sphere.center[2], sphere.radius};
+			markChanged();
+		}
+
+		void Scene::sortRenderQueue()
+		{
+			renderQueue.resize(models.size());
+			for (unsigned int i = 0; i < models.size(); i++)
 			{
-				modelsSorted.insert(model);
+				renderQueue[i].sortKey = models[i]->getSortKey();
+				renderQueue[i].model = models[i].raw();
+				renderQueue[i].sceneIndex = i;
 			}
-			for (auto && model : modelsSorted)
+
+			// LSD radix sort, 8 bits per pass. Passes where every key has the same byte are skipped.
+			renderQueueScratch.resize(renderQueue.size());
+			for (unsigned int shift = 0; shift < 64; shift += 8)
+			{
+				unsigned int counts[256] = {0};
+				for (auto && entry : renderQueue)
+				{
+					counts[(entry.sortKey >> shift) & 0xff]++;
+				}
+				if (renderQueue.empty() || counts[(renderQueue[0].sortKey >> shift) & 0xff] == renderQueue.size())
+				{
+					continue;
+				}
+				unsigned int offset = 0;
+				for (unsigned int i = 0; i < 256; i++)
+				{
+					unsigned int count = counts[i];
+					counts[i] = offset;
+					offset += count;
+				}
+				for (auto && entry : renderQueue)
+				{
+					renderQueueScratch[counts[(entry.sortKey >> shift) & 0xff]++] = entry;
+				}
+				renderQueue.swap(renderQueueScratch);
+			}
+		}
+
+		void Scene::updateInstanceBatches()
+		{
+			// The sort keys put models with the same shader, images and mesh next to each other, so the batches are runs in the queue.
+			instanceBatches.clear();
+			unsigned int begin = 0;
+			while (begin < renderQueue.size())
 			{
-				model->render(stageUniformsFunction, uniformsFunction, flipY);
+				Model const & first = *renderQueue[begin].model;
+				unsigned int end = begin + 1;
+				while (end < renderQueue.size() && first.canBatchWith(*renderQueue[end].model))
+				{
+					end++;
+				}
+				if (end - begin > 1)
+				{
+					instanceBatches.push_back({begin, end});
+				}
+				begin = end;
 			}
 		}
 	}
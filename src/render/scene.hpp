@@ -1,9 +1,12 @@
 #pragma once
 
+#include "render/command_list.hpp"
 #include "render/model.hpp"
-#include <unordered_set>
-#include <unordered_map>
+#include "render/uniform_buffer.hpp"
+#include "util/frustum.hpp"
+#include <atomic>
 #include <set>
+#include <vector>
 
 namespace ve
 {
@@ -26,19 +29,75 @@ namespace ve
 			//! Creates a new model and returns it.
 			Ptr<Model> createModel();
 
-			//! Removes a model.
+			//! Removes a model. The last model takes its place in the model list.
 			void destroyModel(Ptr<Model> model);
 
 			//! Sets the function to be called that sets any scene-specific uniforms. Called every time the shader is changed.
 			void setUniformsFunction(std::function<void(Ptr<Shader> const &)> const & uniformsFunction);
 
-			//! Renders the scene.
-			void render(std::function<void(Ptr<Shader> const &)> const & stageUniformsFunction, bool flipY);
+			//! Sets a uniform buffer to be bound when the scene is rendered, for scene-wide uniforms such as the lighting. It replaces any buffer for the same block.
+			void setUniformBuffer(Ptr<UniformBuffer> const & uniformBuffer);
+
+			//! Marks the scene as changed, so that the targets showing it render again when rendering on demand. It may be called from any thread.
+			//! Changes made through the scene and its models are marked already. Call it for other changes that show, such as to a mesh or to values read by a uniforms function.
+			void markChanged();
+
+			//! Internal to renderer. Returns a count that goes up whenever the scene or its uniform buffers change. Called on the GL thread.
+			unsigned int getChangeCount() const;
+
+			//! Internal to renderer. Sorts the render queue if it has changed. Called on the GL thread before the scene is recorded, since recording doesn't change the scene.
+			void prepare();
+
+			//! Internal to renderer. Records the rendering of the scene into the command list. If frustum is not null, models with bounding spheres outside of it are skipped.
+			//! Consecutive instanced models that share a shader, mesh and images are drawn together in one instanced draw.
+			//! Targets sharing the scene may record it at the same time on different threads.
+			void record(CommandList & commands, std::function<void(Ptr<Shader> const &)> const & stageUniformsFunction, bool flipY, Frustum const * frustum = nullptr) const;
+
+			//! Internal to renderer. Called by a model when its sort key changes.
+			void onModelSortKeyChanged();
+
+			//! Internal to renderer. Called by a model when its shader, mesh or images change, since that may change the batches it can be in.
+			void onModelBatchChanged();
+
+			//! Internal to renderer. Returns the bounding sphere of the model at the scene index.
+			Sphere3f getModelBoundingSphere(unsigned int sceneIndex) const;
+
+			//! Internal to renderer. Sets the bounding sphere of the model at the scene index.
+			void setModelBoundingSphere(unsigned int sceneIndex, Sphere3f const & sphere);
 
 		private:
+			// An entry in the render queue. The key is copied so that sorting doesn't touch the models.
+			struct RenderQueueEntry
+			{
+				uint64_t sortKey;
+				Model * model;
+				unsigned int sceneIndex;
+			};
+
+			// A run of render queue entries drawn in one instanced draw.
+			struct InstanceBatch
+			{
+				unsigned int begin;
+				unsigned int end;
+			};
+
+			// Rebuilds the render queue from the models and sorts it by the sort keys using a stable radix sort.
+			void sortRenderQueue();
+
+			// Rebuilds the instance batches from the sorted render queue.
+			void updateInstanceBatches();
+
 			std::set<Ptr<Target>> dependentTargets;
 			std::function<void(Ptr<Shader> const &)> uniformsFunction;
-			std::unordered_set<OwnPtr<Model>> models;
+			std::vector<Ptr<UniformBuffer>> uniformBuffers;
+			std::vector<OwnPtr<Model>> models;
+			std::vector<Vector4f> modelBoundingSpheres; // The center in xyz and the radius in w, parallel to models so that culling reads them contiguously.
+			std::vector<RenderQueueEntry> renderQueue;
+			std::vector<RenderQueueEntry> renderQueueScratch;
+			std::vector<InstanceBatch> instanceBatches; // Only runs of two or more models, in render queue order.
+			bool renderQueueNeedsSort = false;
+			mutable std::atomic<bool> changed {true}; // Set by markChanged on any thread, and folded into the change count on the GL thread.
+			mutable unsigned int changeCount = 0;
 		};
 	}
 }
\ No newline at end of file
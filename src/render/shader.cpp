@@ -1,7 +1,13 @@
 #include "render/shader.hpp"
+#include "render/command_list.hpp"
 #include "render/open_gl.hpp"
+#include "render/state_cache.hpp"
+#include "render/uniform_buffer.hpp"
 #include "render/mesh.hpp"
 #include "util/stringutil.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 
 // TODO: Make the shader use specific attribute locations chosen by an enum based on the attribute names.
 // This allows multiple shaders to be used with a single vbo and all be compatible.
@@ -23,10 +29,37 @@ namespace ve
 {
 	namespace render
 	{
-		unsigned int currentProgram = 0; // the current open gl shader program
-		Shader::Blending currentBlending = Shader::Blending::NONE; // the current blending state
-		bool currentDepthWrite = true;
-		Shader::DepthTest currentDepthTest = Shader::DepthTest::LESS_OR_EQUAL;
+		Shader * activeShader = nullptr; // The shader whose program is in use.
+		std::atomic<unsigned int> numUniformNameLookups(0); // The number of uniforms looked up by name since the last reset. Names may be looked up while recording on worker threads.
+		unsigned int numSkippedUniformValues = 0; // The number of uniform values skipped since the last reset.
+
+		// The names of the uniform ids, indexed by id, and the ids of the names.
+		struct UniformIdRegistry
+		{
+			std::vector<std::string> names;
+			std::map<std::string, unsigned int> ids;
+			std::vector<Shader *> shaders; // The live shaders, which resolve each new id as it is made.
+		};
+
+		// Records the value if a command list is recording on this thread. Returns true if it was recorded instead of set.
+		template <typename T>
+		bool recordUniformValue(int location, T const & value)
+		{
+			CommandList * recording = CommandList::getRecording();
+			if (recording == nullptr)
+			{
+				return false;
+			}
+			recording->setUniformValue(location, value);
+			return true;
+		}
+
+		// Returns the registry. It is made on first use so that ids can be made during static initialization.
+		UniformIdRegistry & getUniformIdRegistry()
+		{
+			static UniformIdRegistry registry;
+			return registry;
+		}
 
 		Shader::Shader(Config const & shaderConfig)
 		{
@@ -41,6 +74,8 @@ namespace ve
 			glDetachShader(program, fragmentObject);
 			glDeleteShader(fragmentObject);
 			populateUniformInfos();
+			bindUniformBlocks();
+			instanceTransformLocation = glGetAttribLocation(program, "localToWorldTransform");
 		}
 
 		Shader::Shader(ve::Config const & config)
@@ -198,6 +233,8 @@ namespace ve
 				glDeleteShader(shaderObject);
 			}
 			populateUniformInfos();
+			bindUniformBlocks();
+			instanceTransformLocation = glGetAttribLocation(program, "localToWorldTransform");
 		}
 
 		Shader::Shader(std::string const & filename)
@@ -207,7 +244,14 @@ namespace ve
 
 		Shader::~Shader()
 		{
+			std::vector<Shader *> & shaders = getUniformIdRegistry().shaders;
+			shaders.erase(std::remove(shaders.begin(), shaders.end(), this), shaders.end());
 			glDeleteProgram(program);
+			StateCache::onProgramDeleted(program);
+			if (activeShader == this)
+			{
+				activeShader = nullptr;
+			}
 		}
 
 		std::map<std::string, Shader::UniformInfo> const & Shader::getUniformInfos() const
@@ -217,6 +261,7 @@ namespace ve
 
 		Shader::UniformInfo Shader::getUniformInfo(std::string const & name) const
 		{
+			numUniformNameLookups++;
 			auto iter = uniformInfos.find(name);
 			if (iter != uniformInfos.end())
 			{
@@ -228,6 +273,49 @@ namespace ve
 			}
 		}
 
+		Shader::UniformId Shader::getUniformId(std::string const & name)
+		{
+			UniformIdRegistry & registry = getUniformIdRegistry();
+			auto it = registry.ids.find(name);
+			if (it != registry.ids.end())
+			{
+				return UniformId {it->second};
+			}
+			unsigned int index = (unsigned int)registry.names.size();
+			registry.names.push_back(name);
+			registry.ids[name] = index;
+			for (auto shader : registry.shaders)
+			{
+				shader->resolveUniformLocations();
+			}
+			return UniformId {index};
+		}
+
+		int Shader::getUniformLocation(UniformId id) const
+		{
+			return uniformLocations[id.index];
+		}
+
+		unsigned int Shader::getNumUniformNameLookups()
+		{
+			return numUniformNameLookups;
+		}
+
+		void Shader::resetNumUniformNameLookups()
+		{
+			numUniformNameLookups = 0;
+		}
+
+		unsigned int Shader::getNumSkippedUniformValues()
+		{
+			return numSkippedUniformValues;
+		}
+
+		void Shader::resetNumSkippedUniformValues()
+		{
+			numSkippedUniformValues = 0;
+		}
+
 		Shader::Blending Shader::getBlending() const
 		{
 			return blending;
@@ -239,58 +327,29 @@ namespace ve
 			blending = blending_;
 		}
 
+		int Shader::getInstanceTransformLocation() const
+		{
+			return instanceTransformLocation;
+		}
+
+		unsigned int Shader::getGLProgram() const
+		{
+			return program;
+		}
+
 		bool Shader::activate()
 		{
-			if (currentBlending != blending)
-			{
-				if (blending == Blending::NONE)
-				{
-					glDisable(GL_BLEND);
-				}
-				else if (blending == Blending::ADDITIVE)
-				{
-					glEnable(GL_BLEND);
-					glBlendFunc(GL_SRC_ALPHA, GL_ONE);
-				}
-				else if (blending == Blending::ALPHA)
-				{
-					glEnable(GL_BLEND);
-					glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-				}
-				currentBlending = blending;
-			}
-			if (currentDepthWrite != depthWrite)
-			{
-				glDepthMask(depthWrite);
-				currentDepthWrite = depthWrite;
-			}
-			if (currentDepthTest != depthTest)
-			{
-				switch (depthTest)
-				{
-					case NEVER: glDepthFunc(GL_NEVER); break;
-					case ALWAYS: glDepthFunc(GL_ALWAYS); break;
-					case LESS: glDepthFunc(GL_LESS); break;
-					case GREATER: glDepthFunc(GL_GREATER); break;
-					case EQUAL: glDepthFunc(GL_EQUAL); break;
-					case NOT_EQUAL: glDepthFunc(GL_NOTEQUAL); break;
-					case LESS_OR_EQUAL: glDepthFunc(GL_LEQUAL); break;
-					case GREATER_OR_EQUAL: glDepthFunc(GL_GEQUAL); break;
-				}
-			}
-			if (currentProgram != program)
-			{
-				currentProgram = program;
-				glUseProgram(program);
-				return true;
-			}
-			return false;
+			StateCache::setBlending(blending);
+			StateCache::setDepthWrite(depthWrite);
+			StateCache::setDepthTest(depthTest);
+			activeShader = this;
+			return StateCache::useProgram(program);
 		}
 
 		void Shader::deactivate()
 		{
-			currentProgram = 0;
-			glUseProgram(0);
+			activeShader = nullptr;
+			StateCache::useProgram(0);
 		}
 
 		unsigned int Shader::compileShaderObject(Type type, std::string const & code)
@@ -370,6 +429,10 @@ namespace ve
 				glGetActiveUniform(program, i, maxNameSize, &nameSize, &glSize, &glType, &name[0]);
 				name.resize(nameSize);
 				int location = glGetUniformLocation(program, name.c_str());
+				if (location == -1)
+				{
+					continue; // It is in a uniform block, so it is set through a uniform buffer.
+				}
 				UniformType type;
 				switch (glType)
 				{
@@ -387,160 +450,268 @@ namespace ve
 					default: throw std::runtime_error("Invalid type of uniform for '" + name + "'. "); break;
 				}
 				uniformInfos[name] = UniformInfo {location, type};
+				if ((unsigned int)(location + glSize) > uniformShadows.size())
+				{
+					uniformShadows.resize(location + glSize); // Arrays take a location per element.
+				}
+			}
+
+			// Resolve the ids made so far, and register to resolve the ids made later,
+			// so that getting a location never changes the shader and is safe while recording on worker threads.
+			resolveUniformLocations();
+			getUniformIdRegistry().shaders.push_back(this);
+		}
+
+		bool Shader::isUniformValueUnchanged(int location, void const * value, unsigned int size)
+		{
+			if (activeShader == nullptr || location < 0 || (unsigned int)location >= activeShader->uniformShadows.size())
+			{
+				return false;
+			}
+			UniformShadow & shadow = activeShader->uniformShadows[location];
+			if (shadow.valid && std::memcmp(shadow.value, value, size) == 0)
+			{
+				numSkippedUniformValues++;
+				return true;
+			}
+			std::memcpy(shadow.value, value, size);
+			shadow.valid = true;
+			return false;
+		}
+
+		void Shader::resolveUniformLocations()
+		{
+			UniformIdRegistry const & registry = getUniformIdRegistry();
+			for (unsigned int index = (unsigned int)uniformLocations.size(); index < registry.names.size(); index++)
+			{
+				auto it = uniformInfos.find(registry.names[index]);
+				uniformLocations.push_back(it != uniformInfos.end() ? it->second.location : -1);
+			}
+		}
+
+		int Shader::findUniformLocation(char const * name) const
+		{
+			numUniformNameLookups++;
+			auto it = uniformInfos.find(name);
+			if (it != uniformInfos.end())
+			{
+				return it->second.location;
+			}
+			return -1;
+		}
+
+		void Shader::bindUniformBlocks()
+		{
+			GLint numBlocks;
+			GLint maxNameSize;
+			std::string name;
+			glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCKS, &numBlocks);
+			glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxNameSize);
+			for (int i = 0; i < numBlocks; i++)
+			{
+				GLsizei nameSize;
+				name.resize(maxNameSize);
+				glGetActiveUniformBlockName(program, i, maxNameSize, &nameSize, &name[0]);
+				name.resize(nameSize);
+				glUniformBlockBinding(program, i, UniformBuffer::getBindingPoint(name));
 			}
 		}
 
 		template <> void Shader::setUniformValue(int location, int const & value)
 		{
+			if (recordUniformValue(location, value) || isUniformValueUnchanged(location, &value, sizeof(value)))
+			{
+				return;
+			}
 			glUniform1i(location, value);
 		}
 
 		template <> void Shader::setUniformValue(int location, float const & value)
 		{
+			if (recordUniformValue(location, value) || isUniformValueUnchanged(location, &value, sizeof(value)))
+			{
+				return;
+			}
 			glUniform1f(location, value);
 		}
 
 		template <> void Shader::setUniformValue(int location, Vector2i const & value)
 		{
+			if (recordUniformValue(location, value) || isUniformValueUnchanged(location, &value, sizeof(value)))
+			{
+				return;
+			}
 			glUniform2iv(location, 1, value.ptr());
 		}
 
 		template <> void Shader::setUniformValue(int location, Vector3i const & value)
 		{
+			if (recordUniformValue(location, value) || isUniformValueUnchanged(location, &value, sizeof(value)))
+			{
+				return;
+			}
 			glUniform3iv(location, 1, value.ptr());
 		}
 
 		template <> void Shader::setUniformValue(int location, Vector4i const & value)
 		{
+			if (recordUniformValue(location, value) || isUniformValueUnchanged(location, &value, sizeof(value)))
+			{
+				return;
+			}
 			glUniform4iv(location, 1, value.ptr());
 		}
 
 		template <> void Shader::setUniformValue(int location, Vector2f const & value)
 		{
+			if (recordUniformValue(location, value) || isUniformValueUnchanged(location, &value, sizeof(value)))
+			{
+				return;
+			}
 			glUniform2fv(location, 1, value.ptr());
 		}
 
 		template <> void Shader::setUniformValue(int location, Vector3f const & value)
 		{
+			if (recordUniformValue(location, value) || isUniformValueUnchanged(location, &value, sizeof(value)))
+			{
+				return;
+			}
 			glUniform3fv(location, 1, value.ptr());
 		}
 
 		template <> void Shader::setUniformValue(int location, Vector4f const & value)
 		{
+			if (recordUniformValue(location, value) || isUniformValueUnchanged(location, &value, sizeof(value)))
+			{
+				return;
+			}
 			glUniform4fv(location, 1, value.ptr());
 		}
 
 		template <> void Shader::setUniformValue(int location, Matrix22f const & value)
 		{
+			if (recordUniformValue(location, value) || isUniformValueUnchanged(location, &value, sizeof(value)))
+			{
+				return;
+			}
 			glUniformMatrix2fv(location, 1, false, value.ptr());
 		}
 
 		template <> void Shader::setUniformValue(int location, Matrix33f const & value)
 		{
+			if (recordUniformValue(location, value) || isUniformValueUnchanged(location, &value, sizeof(value)))
+			{
+				return;
+			}
 			glUniformMatrix3fv(location, 1, false, value.ptr());
 		}
 
 		template <> void Shader::setUniformValue(int location, Matrix44f const & value)
 		{
+			if (recordUniformValue(location, value) || isUniformValueUnchanged(location, &value, sizeof(value)))
+			{
+				return;
+			}
 			glUniformMatrix4fv(location, 1, false, value.ptr());
 		}
 
 		template <> void Shader::setUniformValue(char const * location, int const & value)
 		{
-			auto it = uniformInfos.find(location);
-			if (it != uniformInfos.end())
+			int uniformLocation = findUniformLocation(location);
+			if (uniformLocation != -1)
 			{
-				setUniformValue(it->second.location, value);
+				setUniformValue(uniformLocation, value);
 			}
 		}
 
 		template <> void Shader::setUniformValue(char const * location, float const & value)
 		{
-			auto it = uniformInfos.find(location);
-			if (it != uniformInfos.end())
+			int uniformLocation = findUniformLocation(location);
+			if (uniformLocation != -1)
 			{
-				setUniformValue(it->second.location, value);
+				setUniformValue(uniformLocation, value);
 			}
 		}
 
 		template <> void Shader::setUniformValue(char const * location, Vector2i const & value)
 		{
-			auto it = uniformInfos.find(location);
-			if (it != uniformInfos.end())
+			int uniformLocation = findUniformLocation(location);
+			if (uniformLocation != -1)
 			{
-				setUniformValue(it->second.location, value);
+				setUniformValue(uniformLocation, value);
 			}
 		}
 
 		template <> void Shader::setUniformValue(char const * location, Vector3i const & value)
 		{
-			auto it = uniformInfos.find(location);
-			if (it != uniformInfos.end())
+			int uniformLocation = findUniformLocation(location);
+			if (uniformLocation != -1)
 			{
-				setUniformValue(it->second.location, value);
+				setUniformValue(uniformLocation, value);
 			}
 		}
 
 		template <> void Shader::setUniformValue(char const * location, Vector4i const & value)
 		{
-			auto it = uniformInfos.find(location);
-			if (it != uniformInfos.end())
+			int uniformLocation = findUniformLocation(location);
+			if (uniformLocation != -1)
 			{
-				setUniformValue(it->second.location, value);
+				setUniformValue(uniformLocation, value);
 			}
 		}
 
 		template <> void Shader::setUniformValue(char const * location, Vector2f const & value)
 		{
-			auto it = uniformInfos.find(location);
-			if (it != uniformInfos.end())
+			int uniformLocation = findUniformLocation(location);
+			if (uniformLocation != -1)
 			{
-				setUniformValue(it->second.location, value);
+				setUniformValue(uniformLocation, value);
 			}
 		}
 
 		template <> void Shader::setUniformValue(char const * location, Vector3f const & value)
 		{
-			auto it = uniformInfos.find(location);
-			if (it != uniformInfos.end())
+			int uniformLocation = findUniformLocation(location);
+			if (uniformLocation != -1)
 			{
-				setUniformValue(it->second.location, value);
+				setUniformValue(uniformLocation, value);
 			}
 		}
 
 		template <> void Shader::setUniformValue(char const * location, Vector4f const & value)
 		{
-			auto it = uniformInfos.find(location);
-			if (it != uniformInfos.end())
+			int uniformLocation = findUniformLocation(location);
+			if (uniformLocation != -1)
 			{
-				setUniformValue(it->second.location, value);
+				setUniformValue(uniformLocation, value);
 			}
 		}
 
 		template <> void Shader::setUniformValue(char const * location, Matrix22f const & value)
 		{
-			auto it = uniformInfos.find(location);
-			if (it != uniformInfos.end())
+			int uniformLocation = findUniformLocation(location);
+			if (uniformLocation != -1)
 			{
-				setUniformValue(it->second.location, value);
+				setUniformValue(uniformLocation, value);
 			}
 		}
 
 		template <> void Shader::setUniformValue(char const * location, Matrix33f const & value)
 		{
-			auto it = uniformInfos.find(location);
-			if (it != uniformInfos.end())
+			int uniformLocation = findUniformLocation(location);
+			if (uniformLocation != -1)
 			{
-				setUniformValue(it->second.location, value);
+				setUniformValue(uniformLocation, value);
 			}
 		}
 
 		template <> void Shader::setUniformValue(char const * location, Matrix44f const & value)
 		{
-			auto it = uniformInfos.find(location);
-			if (it != uniformInfos.end())
+			int uniformLocation = findUniformLocation(location);
+			if (uniformLocation != -1)
 			{
-				setUniformValue(it->second.location, value);
+				setUniformValue(uniformLocation, value);
 			}
 		}
 	}
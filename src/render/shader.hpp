@@ -5,6 +5,7 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <cstdint>
 
 namespace ve
 {
@@ -27,6 +28,12 @@ namespace ve
 				UniformType type;
 			};
 
+			// An interned uniform name. Each shader resolves an id to its location once, so that setting a uniform by id is an index lookup.
+			struct UniformId
+			{
+				unsigned int index;
+			};
+
 			struct Config
 			{
 				std::string vertexCode;
@@ -54,18 +61,47 @@ namespace ve
 			// Returns the information on a uniform given the name. If it isn't found, it returns -1 for the location.
 			UniformInfo getUniformInfo(std::string const & name) const;
 
-			// Sets a uniform value of the currently active shader. Value types for T are below this class definition.
+			// Returns the id of the uniform name. Every call with the same name returns the same id, so get it once and keep it, such as in a global. Not thread-safe, and not to be called while recording.
+			static UniformId getUniformId(std::string const & name);
+
+			// Returns the location of the uniform with the id, or -1 if the shader doesn't have it.
+			int getUniformLocation(UniformId id) const;
+
+			// Sets a uniform value of the currently active shader. Value types for T are below this class definition. It is skipped if it is the value last set at the location.
+			// If a command list is recording on this thread, the value is recorded into it instead.
 			template <typename T> static void setUniformValue(int location, T const & value);
 
+			// Sets a uniform value of the currently active shader by its id. Value types for T are below this class definition.
+			template <typename T> void setUniformValue(UniformId id, T const & value);
+
 			// Sets a uniform value of the currently active shader. Value types for T are below this class definition. Slower than using the location because of the string lookup.
 			template <typename T> void setUniformValue(char const * name, T const & value);
 
+			// Returns the number of uniforms looked up by name, with getUniformInfo or setUniformValue, since the last reset. Uniforms set often should use ids instead.
+			static unsigned int getNumUniformNameLookups();
+
+			// Resets the number of uniforms looked up by name. App does this at the start of each render.
+			static void resetNumUniformNameLookups();
+
+			// Returns the number of uniform values skipped because they were the values last set, since the last reset.
+			static unsigned int getNumSkippedUniformValues();
+
+			// Resets the number of skipped uniform values. App does this at the start of each render.
+			static void resetNumSkippedUniformValues();
+
 			// Returns the blending state.
 			Blending getBlending() const;
 
-			// Sets the blending state.
+			// Sets the blending state. Models already using this shader keep their sort order until they are next changed.
 			void setBlending(Blending blending);
 
+			// Returns the location of the mat4 vertex attribute localToWorldTransform, or -1 if the shader doesn't have one.
+			// Models with such a shader get their transform per instance and are drawn in batches with the models that share their mesh and images.
+			int getInstanceTransformLocation() const;
+
+			// Internal to renderer. Returns the GL program id.
+			unsigned int getGLProgram() const;
+
 			// Activates the current shader and returns true. If it was already activated, returns false.
 			bool activate();
 
@@ -75,21 +111,53 @@ namespace ve
 		private:
 			enum Type { Vertex, Fragment, NumCodeTypes };
 
+			// The last value set at a uniform location.
+			struct UniformShadow
+			{
+				uint8_t value[sizeof(Matrix44f)];
+				bool valid = false;
+			};
+
+			// Returns true if the value is the one last set at the location in the active shader. Otherwise it records the value and returns false.
+			static bool isUniformValueUnchanged(int location, void const * value, unsigned int size);
+
 			static unsigned int compileShaderObject(Type type, std::string const & code);
 
 			static unsigned int linkShaderProgram(std::vector<unsigned int> const & shaderObjects);
 
 			void populateUniformInfos();
 
+			// Resolves the locations of the uniform ids made since the last call.
+			void resolveUniformLocations();
+
+			// Returns the location of the uniform with the name, or -1 if the shader doesn't have it. Counts as a name lookup.
+			int findUniformLocation(char const * name) const;
+
+			// Binds each uniform block to the binding point of the uniform buffers of the same name.
+			void bindUniformBlocks();
+
 			std::map<std::string, UniformInfo> uniformInfos;
+			std::vector<int> uniformLocations; // Indexed by uniform id. Kept resolved for every id.
+			std::vector<UniformShadow> uniformShadows; // Indexed by location. The program keeps its uniform values while other programs are used.
 
 			unsigned int program;
+			int instanceTransformLocation;
 
 			Blending blending;
 			bool depthWrite;
 			DepthTest depthTest;
 		};
 
+		template <typename T>
+		void Shader::setUniformValue(UniformId id, T const & value)
+		{
+			int location = getUniformLocation(id);
+			if (location != -1)
+			{
+				setUniformValue(location, value);
+			}
+		}
+
 		template <> void Shader::setUniformValue(int location, int const & value);
 		template <> void Shader::setUniformValue(int location, float const & value);
 		template <> void Shader::setUniformValue(int location, Vector2i const & value);
@@ -0,0 +1,334 @@
+#include "render/state_cache.hpp"
+#include "render/open_gl.hpp"
+#include <vector>
+
+namespace ve
+{
+	namespace render
+	{
+		// The value of a state that isn't known, so that the next call is always made.
+		unsigned int const unknown = 0xffffffff;
+
+		// The GL buffer targets that are tracked.
+		enum BufferTarget { ARRAY_BUFFER, ELEMENT_ARRAY_BUFFER, UNIFORM_BUFFER, NUM_BUFFER_TARGETS };
+
+		// The state of the GL context.
+		struct State
+		{
+			unsigned int blending = unknown;
+			unsigned int depthWrite = unknown;
+			unsigned int depthTestEnabled = unknown;
+			unsigned int depthTest = unknown;
+			unsigned int backFaceCulling = unknown;
+			unsigned int cullFace = unknown;
+			Recti viewport = Recti(Vector2i {0, 0}, Vector2i {-1, -1}); // An empty viewport never matches.
+			unsigned int framebuffer = unknown;
+			unsigned int program = unknown;
+			unsigned int vertexArray = unknown;
+			unsigned int buffers[NUM_BUFFER_TARGETS] = {unknown, unknown, unknown};
+			unsigned int activeTextureSlot = unknown;
+			std::vector<unsigned int> uniformBuffers; // Indexed by binding point. Binding points past the end are unknown.
+			std::vector<unsigned int> textures; // Slots past the end have no texture bound.
+			unsigned int numSkippedCalls = 0;
+		};
+
+		State state;
+
+		// Returns the index of the GL buffer target in the state, or NUM_BUFFER_TARGETS if it isn't tracked.
+		BufferTarget getBufferTarget(unsigned int target)
+		{
+			switch (target)
+			{
+				case GL_ARRAY_BUFFER: return ARRAY_BUFFER;
+				case GL_ELEMENT_ARRAY_BUFFER: return ELEMENT_ARRAY_BUFFER;
+				case GL_UNIFORM_BUFFER: return UNIFORM_BUFFER;
+				default: return NUM_BUFFER_TARGETS;
+			}
+		}
+
+		void setActiveTextureSlot(unsigned int slot)
+		{
+			if (state.activeTextureSlot != slot)
+			{
+				glActiveTexture(GL_TEXTURE0 + slot);
+				state.activeTextureSlot = slot;
+			}
+			else
+			{
+				state.numSkippedCalls++;
+			}
+		}
+
+		void StateCache::invalidate()
+		{
+			unsigned int numSkippedCalls = state.numSkippedCalls;
+			std::vector<unsigned int> textures;
+			textures.swap(state.textures);
+			state = State();
+			state.numSkippedCalls = numSkippedCalls;
+			state.textures.swap(textures);
+			for (auto && texture : state.textures)
+			{
+				texture = unknown;
+			}
+		}
+
+		void StateCache::setBlending(Shader::Blending blending)
+		{
+			if (state.blending == (unsigned int)blending)
+			{
+				state.numSkippedCalls++;
+				return;
+			}
+			if (blending == Shader::Blending::NONE)
+			{
+				glDisable(GL_BLEND);
+			}
+			else if (blending == Shader::Blending::ADDITIVE)
+			{
+				glEnable(GL_BLEND);
+				glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+			}
+			else if (blending == Shader::Blending::ALPHA)
+			{
+				glEnable(GL_BLEND);
+				glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+			}
+			state.blending = blending;
+		}
+
+		void StateCache::setDepthWrite(bool depthWrite)
+		{
+			if (state.depthWrite == (unsigned int)depthWrite)
+			{
+				state.numSkippedCalls++;
+				return;
+			}
+			glDepthMask(depthWrite ? GL_TRUE : GL_FALSE);
+			state.depthWrite = depthWrite;
+		}
+
+		void StateCache::setDepthTest(Shader::DepthTest depthTest)
+		{
+			if (state.depthTestEnabled != 1)
+			{
+				glEnable(GL_DEPTH_TEST);
+				state.depthTestEnabled = 1;
+			}
+			else
+			{
+				state.numSkippedCalls++;
+			}
+			if (state.depthTest == (unsigned int)depthTest)
+			{
+				state.numSkippedCalls++;
+				return;
+			}
+			switch (depthTest)
+			{
+				case Shader::NEVER: glDepthFunc(GL_NEVER); break;
+				case Shader::ALWAYS: glDepthFunc(GL_ALWAYS); break;
+				case Shader::LESS: glDepthFunc(GL_LESS); break;
+				case Shader::GREATER: glDepthFunc(GL_GREATER); break;
+				case Shader::EQUAL: glDepthFunc(GL_EQUAL); break;
+				case Shader::NOT_EQUAL: glDepthFunc(GL_NOTEQUAL); break;
+				case Shader::LESS_OR_EQUAL: glDepthFunc(GL_LEQUAL); break;
+				case Shader::GREATER_OR_EQUAL: glDepthFunc(GL_GEQUAL); break;
+			}
+			state.depthTest = depthTest;
+		}
+
+		void StateCache::setBackFaceCulling(bool culling)
+		{
+			if (state.backFaceCulling == (unsigned int)culling)
+			{
+				state.numSkippedCalls++;
+				return;
+			}
+			if (culling)
+			{
+				glEnable(GL_CULL_FACE);
+				if (state.cullFace != GL_BACK)
+				{
+					glCullFace(GL_BACK);
+					state.cullFace = GL_BACK;
+				}
+			}
+			else
+			{
+				glDisable(GL_CULL_FACE);
+			}
+			state.backFaceCulling = culling;
+		}
+
+		void StateCache::setViewport(Recti const & viewport)
+		{
+			if (state.viewport.min == viewport.min && state.viewport.max == viewport.max)
+			{
+				state.numSkippedCalls++;
+				return;
+			}
+			glViewport(viewport.min[0], viewport.min[1], viewport.max[0] - viewport.min[0], viewport.max[1] - viewport.min[1]);
+			state.viewport = viewport;
+		}
+
+		void StateCache::bindFramebuffer(unsigned int framebuffer)
+		{
+			if (state.framebuffer == framebuffer)
+			{
+				state.numSkippedCalls++;
+				return;
+			}
+			glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+			state.framebuffer = framebuffer;
+		}
+
+		bool StateCache::useProgram(unsigned int program)
+		{
+			if (state.program == program)
+			{
+				state.numSkippedCalls++;
+				return false;
+			}
+			glUseProgram(program);
+			state.program = program;
+			return true;
+		}
+
+		void StateCache::bindVertexArray(unsigned int vertexArray)
+		{
+			if (state.vertexArray == vertexArray)
+			{
+				state.numSkippedCalls++;
+				return;
+			}
+			glBindVertexArray(vertexArray);
+			state.vertexArray = vertexArray;
+			state.buffers[ELEMENT_ARRAY_BUFFER] = unknown; // It is stored in the vertex array object.
+		}
+
+		void StateCache::bindBuffer(unsigned int target, unsigned int buffer)
+		{
+			BufferTarget bufferTarget = getBufferTarget(target);
+			if (bufferTarget == NUM_BUFFER_TARGETS)
+			{
+				glBindBuffer(target, buffer);
+				return;
+			}
+			if (state.buffers[bufferTarget] == buffer)
+			{
+				state.numSkippedCalls++;
+				return;
+			}
+			glBindBuffer(target, buffer);
+			state.buffers[bufferTarget] = buffer;
+		}
+
+		void StateCache::bindUniformBuffer(unsigned int bindingPoint, unsigned int buffer)
+		{
+			if (bindingPoint < state.uniformBuffers.size() && state.uniformBuffers[bindingPoint] == buffer)
+			{
+				state.numSkippedCalls++;
+				return;
+			}
+			glBindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, buffer);
+			if (bindingPoint >= state.uniformBuffers.size())
+			{
+				state.uniformBuffers.resize(bindingPoint + 1, unknown);
+			}
+			state.uniformBuffers[bindingPoint] = buffer;
+			state.buffers[UNIFORM_BUFFER] = buffer;
+		}
+
+		void StateCache::bindTexture(unsigned int slot, unsigned int texture)
+		{
+			if (slot < state.textures.size() ? state.textures[slot] == texture : texture == 0)
+			{
+				state.numSkippedCalls++;
+				return;
+			}
+			setActiveTextureSlot(slot);
+			glBindTexture(GL_TEXTURE_2D, texture);
+			if (slot >= state.textures.size())
+			{
+				state.textures.resize(slot + 1, 0);
+			}
+			state.textures[slot] = texture;
+		}
+
+		void StateCache::unbindTextures(unsigned int slot)
+		{
+			for (; slot < state.textures.size(); slot++)
+			{
+				if (state.textures[slot] != 0)
+				{
+					bindTexture(slot, 0);
+				}
+			}
+		}
+
+		void StateCache::onProgramDeleted(unsigned int program)
+		{
+			if (state.program == program)
+			{
+				state.program = unknown;
+			}
+		}
+
+		void StateCache::onVertexArrayDeleted(unsigned int vertexArray)
+		{
+			if (state.vertexArray == vertexArray)
+			{
+				state.vertexArray = unknown;
+				state.buffers[ELEMENT_ARRAY_BUFFER] = unknown;
+			}
+		}
+
+		void StateCache::onBufferDeleted(unsigned int buffer)
+		{
+			for (auto && bound : state.buffers)
+			{
+				if (bound == buffer)
+				{
+					bound = unknown;
+				}
+			}
+			for (auto && bound : state.uniformBuffers)
+			{
+				if (bound == buffer)
+				{
+					bound = unknown;
+				}
+			}
+		}
+
+		void StateCache::onTextureDeleted(unsigned int texture)
+		{
+			for (auto && bound : state.textures)
+			{
+				if (bound == texture)
+				{
+					bound = unknown;
+				}
+			}
+		}
+
+		void StateCache::onFramebufferDeleted(unsigned int framebuffer)
+		{
+			if (state.framebuffer == framebuffer)
+			{
+				state.framebuffer = unknown;
+			}
+		}
+
+		unsigned int StateCache::getNumSkippedCalls()
+		{
+			return state.numSkippedCalls;
+		}
+
+		void StateCache::resetNumSkippedCalls()
+		{
+			state.numSkippedCalls = 0;
+		}
+	}
+}
\ No newline at end of file
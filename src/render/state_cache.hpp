@@ -0,0 +1,76 @@
+#pragma once
+
+#include "render/shader.hpp"
+#include "util/rect.hpp"
+
+namespace ve
+{
+	namespace render
+	{
+		// Internal to renderer. Tracks the GL state of the context so that setting a state to what it already is skips the GL call.
+		// All state changes in the renderer go through here, so that nothing gets out of sync with it.
+		class StateCache final
+		{
+		public:
+			// Forgets all of the state, so that the next calls are all made. Call it when the context is created or when other code has changed the state.
+			static void invalidate();
+
+			// Sets the blending.
+			static void setBlending(Shader::Blending blending);
+
+			// Sets whether depth values are written.
+			static void setDepthWrite(bool depthWrite);
+
+			// Enables the depth test and sets its function.
+			static void setDepthTest(Shader::DepthTest depthTest);
+
+			// Sets whether back faces are culled.
+			static void setBackFaceCulling(bool culling);
+
+			// Sets the viewport in pixels.
+			static void setViewport(Recti const & viewport);
+
+			// Binds the framebuffer. 0 is the window.
+			static void bindFramebuffer(unsigned int framebuffer);
+
+			// Uses the shader program. Returns true if it wasn't already in use.
+			static bool useProgram(unsigned int program);
+
+			// Binds the vertex array object.
+			static void bindVertexArray(unsigned int vertexArray);
+
+			// Binds the buffer to the target, such as GL_ARRAY_BUFFER. The GL_ELEMENT_ARRAY_BUFFER binding belongs to the bound vertex array object.
+			static void bindBuffer(unsigned int target, unsigned int buffer);
+
+			// Binds the buffer to the indexed uniform buffer binding point. It also becomes the GL_UNIFORM_BUFFER binding.
+			static void bindUniformBuffer(unsigned int bindingPoint, unsigned int buffer);
+
+			// Binds the 2D texture to the texture unit at the slot.
+			static void bindTexture(unsigned int slot, unsigned int texture);
+
+			// Unbinds the textures at the slot and every slot after it.
+			static void unbindTextures(unsigned int slot);
+
+			// Called when the program is deleted, since GL may reuse its id.
+			static void onProgramDeleted(unsigned int program);
+
+			// Called when the vertex array object is deleted, since GL may reuse its id.
+			static void onVertexArrayDeleted(unsigned int vertexArray);
+
+			// Called when the buffer is deleted, since GL may reuse its id.
+			static void onBufferDeleted(unsigned int buffer);
+
+			// Called when the texture is deleted, since GL may reuse its id.
+			static void onTextureDeleted(unsigned int texture);
+
+			// Called when the framebuffer is deleted, since GL may reuse its id.
+			static void onFramebufferDeleted(unsigned int framebuffer);
+
+			// Returns the number of GL calls skipped since the last reset because the state was already set.
+			static unsigned int getNumSkippedCalls();
+
+			// Resets the number of skipped calls to zero.
+			static void resetNumSkippedCalls();
+		};
+	}
+}
\ No newline at end of file
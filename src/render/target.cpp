@@ -1,5 +1,6 @@
 #include "render/target.hpp"
 #include "render/open_gl.hpp"
+#include "render/state_cache.hpp"
 #include <log.hpp>
 #include <SDL.h>
 
@@ -23,11 +24,57 @@ namespace ve
 		void Target::setScene(Ptr<Scene> scene_)
 		{
 			scene = scene_;
+			markChanged();
 		}
 
 		void Target::setUniformsFunction(std::function<void(Ptr<Shader> const &)> const & uniformsFunction_)
 		{
 			uniformsFunction = uniformsFunction_;
+			markChanged();
+		}
+
+		void Target::setUniformBuffer(Ptr<UniformBuffer> const & uniformBuffer)
+		{
+			markChanged();
+			for (auto && existing : uniformBuffers)
+			{
+				if (existing.isValid() && existing->getBindingPoint() == uniformBuffer->getBindingPoint())
+				{
+					existing = uniformBuffer;
+					return;
+				}
+			}
+			uniformBuffers.push_back(uniformBuffer);
+		}
+
+		void Target::setFrustumFunction(std::function<Frustum()> const & frustumFunction_)
+		{
+			frustumFunction = frustumFunction_;
+			markChanged();
+		}
+
+		void Target::markChanged()
+		{
+			changed = true;
+		}
+
+		bool Target::needsRender() const
+		{
+			if (changed || getChangeCount() != recordedChangeCount)
+			{
+				return true;
+			}
+			if (scene.isValid())
+			{
+				for (auto && dependentTarget : scene->getDependentTargets())
+				{
+					if (dependentTarget->needsRender())
+					{
+						return true;
+					}
+				}
+			}
+			return false;
 		}
 
 		void Target::clearRenderedThisFrameFlag()
@@ -47,42 +94,146 @@ namespace ve
 
 		void Target::render() const
 		{
-			if (!scene.isValid())
+			recordTargets(nullptr);
+			replay();
+		}
+
+		void Target::render(TaskScheduler & taskScheduler) const
+		{
+			recordTargets(&taskScheduler);
+			replay();
+		}
+
+		void Target::record(TaskScheduler & taskScheduler) const
+		{
+			recordTargets(&taskScheduler);
+		}
+
+		void Target::replay() const
+		{
+			// Replay on this thread, with each target after the targets it depends on.
+			for (auto target : recordedTargets)
 			{
-				return;
+				target->replayCommands();
 			}
+			recordedTargets.clear();
+		}
 
-			// Clear out the shaders and textures.
-			Shader::deactivate();
-			Image::deactivateRest(0);
+		void Target::recordTargets(TaskScheduler * taskScheduler) const
+		{
+			recordedTargets.clear();
+			gatherTargetsToRender(recordedTargets);
 
+			// Keep what was recorded, so that on demand the targets only render again once something changes.
+			for (auto target : recordedTargets)
+			{
+				target->recordedChangeCount = target->getChangeCount();
+				target->changed = false;
+			}
+
+			// Sort the scenes first, since recording doesn't change them and a scene may be recorded by more than one target.
+			for (auto target : recordedTargets)
+			{
+				target->scene->prepare();
+			}
+
+			// Record each target's commands. Nothing here touches GL, so the targets can be recorded on the worker threads.
+			if (taskScheduler != nullptr && recordedTargets.size() > 1)
+			{
+				taskScheduler->parallelFor(0, (unsigned int)recordedTargets.size(), [this](unsigned int i)
+				{
+					recordedTargets[i]->recordCommands();
+				});
+			}
+			else
+			{
+				for (auto target : recordedTargets)
+				{
+					target->recordCommands();
+				}
+			}
+		}
+
+		void Target::gatherTargetsToRender(std::vector<Target const *> & targets) const
+		{
+			if (!scene.isValid())
+			{
+				return;
+			}
+			renderedThisFrame = true;
 			for (auto && dependentTarget : scene->getDependentTargets())
 			{
 				if (!dependentTarget->renderedThisFrame)
 				{
-					dependentTarget->render();
+					dependentTarget->gatherTargetsToRender(targets);
+				}
+			}
+			targets.push_back(this);
+		}
+
+		void Target::recordCommands() const
+		{
+			commands.beginRecording();
+			try
+			{
+				if (frustumFunction)
+				{
+					Frustum frustum = frustumFunction();
+					scene->record(commands, uniformsFunction, flipY, &frustum);
 				}
+				else
+				{
+					scene->record(commands, uniformsFunction, flipY);
+				}
+			}
+			catch (...)
+			{
+				commands.endRecording();
+				throw;
 			}
+			commands.endRecording();
+		}
+
+		void Target::replayCommands() const
+		{
+			// Clear out the shaders and textures.
+			Shader::deactivate();
+			Image::deactivateRest(0);
 
 			preRender();
 
-			glEnable(GL_CULL_FACE);
-			glCullFace(GL_BACK);
-			glEnable(GL_DEPTH_TEST);
-			glDepthFunc(GL_LESS);
-			glDepthMask(GL_TRUE);
-			glEnable(GL_BLEND);
-			glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+			// The blending and depth state is set by each shader as it is activated. The depth mask must be on for the clear.
+			StateCache::setBackFaceCulling(true);
+			StateCache::setDepthWrite(true);
 			//glClearColor(0, 0, 0, 1);
 			glClearDepth(1.0);
-			glViewport(0, 0, getSize()[0], getSize()[1]);
+			StateCache::setViewport(Recti(Vector2i {0, 0}, getSize()));
 			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-			scene->render(uniformsFunction, flipY);
+			for (auto && uniformBuffer : uniformBuffers)
+			{
+				if (uniformBuffer.isValid())
+				{
+					uniformBuffer->bind();
+				}
+			}
+
+			commands.replay();
 
 			postRender();
+		}
 
-			renderedThisFrame = true;
+		unsigned int Target::getChangeCount() const
+		{
+			unsigned int count = scene.isValid() ? scene->getChangeCount() : 0;
+			for (auto && uniformBuffer : uniformBuffers)
+			{
+				if (uniformBuffer.isValid())
+				{
+					count += uniformBuffer->getChangeCount();
+				}
+			}
+			return count;
 		}
 
 		WindowTarget::WindowTarget(void * sdlWindow_)
@@ -94,9 +245,13 @@ namespace ve
 
 			if (numWindowTargets == 0)
 			{
-				glContext = SDL_GL_CreateContext((SDL_Window *)sdlWindow);
-				SDL_GL_MakeCurrent((SDL_Window *)sdlWindow, glContext);
+				if (sdlWindow != nullptr)
+				{
+					glContext = SDL_GL_CreateContext((SDL_Window *)sdlWindow);
+					SDL_GL_MakeCurrent((SDL_Window *)sdlWindow, glContext);
+				}
 				glInitialize();
+				StateCache::invalidate();
 				Log::write((char const *)glGetString(GL_VERSION));
 			}
 
@@ -106,14 +261,19 @@ namespace ve
 		WindowTarget::~WindowTarget()
 		{
 			numWindowTargets--;
-			if (numWindowTargets == 0)
+			if (numWindowTargets == 0 && glContext != nullptr)
 			{
 				SDL_GL_DeleteContext(glContext);
+				glContext = nullptr;
 			}
 		}
 
 		Vector2i WindowTarget::getSize() const
 		{
+			if (sdlWindow == nullptr)
+			{
+				return headlessSize;
+			}
 			Vector2i size;
 			SDL_GetWindowSize((SDL_Window *)sdlWindow, &size[0], &size[1]);
 			return size;
@@ -121,14 +281,20 @@ namespace ve
 
 		void WindowTarget::preRender() const
 		{
-			SDL_GL_MakeCurrent((SDL_Window *)sdlWindow, glContext);
-			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			if (sdlWindow != nullptr)
+			{
+				SDL_GL_MakeCurrent((SDL_Window *)sdlWindow, glContext);
+			}
+			StateCache::bindFramebuffer(0);
 			glClearColor(1, 0, 0, 1);
 		}
 
 		void WindowTarget::postRender() const
 		{
-			SDL_GL_SwapWindow((SDL_Window *)sdlWindow);
+			if (sdlWindow != nullptr)
+			{
+				SDL_GL_SwapWindow((SDL_Window *)sdlWindow);
+			}
 		}
 
 		ImageTarget::ImageTarget()
@@ -143,6 +309,7 @@ namespace ve
 		ImageTarget::~ImageTarget()
 		{
 			glDeleteFramebuffers(1, &framebuffer);
+			StateCache::onFramebufferDeleted(framebuffer);
 		}
 
 		Vector2i ImageTarget::getSize() const
@@ -164,22 +331,23 @@ namespace ve
 
 		void ImageTarget::setSize(Vector2i size)
 		{
+			markChanged();
 			for (unsigned int i = 0; i < colorImages.size(); i++)
 			{
 				colorImages[i]->setSize(size);
-				glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+				StateCache::bindFramebuffer(framebuffer);
 				colorImages[i]->attachToFrameBuffer(GL_COLOR_ATTACHMENT0 + i);
 			}
 			if (depthImage.isValid())
 			{
 				depthImage->setSize(size);
-				glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+				StateCache::bindFramebuffer(framebuffer);
 				depthImage->attachToFrameBuffer(GL_DEPTH_ATTACHMENT);
 			}
 			if (stencilImage.isValid())
 			{
 				stencilImage->setSize(size);
-				glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+				StateCache::bindFramebuffer(framebuffer);
 				stencilImage->attachToFrameBuffer(GL_STENCIL_ATTACHMENT);
 			}
 		}
@@ -198,13 +366,14 @@ namespace ve
 
 		void ImageTarget::setColorImage(unsigned int index, Ptr<Image> image)
 		{
+			markChanged();
 			image->setSize(getSize());
 			if (index >= colorImages.size())
 			{
 				colorImages.resize(index + 1);
 			}
 			colorImages[index] = image;
-			glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+			StateCache::bindFramebuffer(framebuffer);
 			image->attachToFrameBuffer(GL_COLOR_ATTACHMENT0 + index);
 			std::vector<unsigned int> indices;
 			for (unsigned int i = 0; i < colorImages.size(); i++)
@@ -228,9 +397,10 @@ namespace ve
 
 		void ImageTarget::setDepthImage(Ptr<Image> image)
 		{
+			markChanged();
 			image->setSize(getSize());
 			depthImage = image;
-			glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+			StateCache::bindFramebuffer(framebuffer);
 			image->attachToFrameBuffer(GL_DEPTH_ATTACHMENT);
 		}
 
@@ -241,14 +411,16 @@ namespace ve
 
 		void ImageTarget::setStencilImage(Ptr<Image> image)
 		{
+			markChanged();
 			image->setSize(getSize());
 			stencilImage = image;
-			glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+			StateCache::bindFramebuffer(framebuffer);
 			image->attachToFrameBuffer(GL_STENCIL_ATTACHMENT);
 		}
 
 		void ImageTarget::clearAllImages()
 		{
+			markChanged();
 			colorImages.clear();
 			depthImage.setNull();
 			stencilImage.setNull();
@@ -256,7 +428,7 @@ namespace ve
 
 		void ImageTarget::preRender() const
 		{
-			glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+			StateCache::bindFramebuffer(framebuffer);
 			glClearColor(0, 0, 1, 1);
 		}
 
@@ -1,10 +1,13 @@
 #pragma once
 
+#include "render/command_list.hpp"
 #include "render/image.hpp"
 #include "render/scene.hpp"
 #include "util/rect.hpp"
 #include "util/ptr.hpp"
+#include "util/task_scheduler.hpp"
 #include <set>
+#include <vector>
 
 namespace ve
 {
@@ -28,12 +31,35 @@ namespace ve
 			//! Sets a function to be called that sets any target-specific uniforms. Called every time the shader is changed.
 			virtual void setUniformsFunction(std::function<void(Ptr<Shader> const &)> const & uniformsFunction);
 
+			//! Sets a uniform buffer to be bound when the target is rendered, for target-wide uniforms such as the camera. It replaces any buffer for the same block.
+			void setUniformBuffer(Ptr<UniformBuffer> const & uniformBuffer);
+
+			//! Sets a function that returns the view frustum in scene coordinates. Models outside of it are skipped. If there is no function, no models are skipped.
+			void setFrustumFunction(std::function<Frustum()> const & frustumFunction);
+
+			//! Marks the target as changed, so that it renders again when rendering on demand, such as when something its uniforms function reads has changed.
+			void markChanged();
+
+			//! Returns true if the target has been marked changed, or its scene or uniform buffers have changed, since it last rendered, or if a target its scene depends on needs to render.
+			bool needsRender() const;
+
 			//! Clears the renderedThisFrame flag for proper scene/target dependency graph travel.
 			void clearRenderedThisFrameFlag();
 
 			//! Renders the scene to the target. First renders all targets upon which the scene depends.
 			void render() const;
 
+			//! Renders like render(), but the scenes of this target and of the targets it depends on are recorded in parallel on the task scheduler.
+			//! The GL calls are still made on this thread, in order. The uniforms and frustum functions may be called on worker threads, so they must only read shared state.
+			void render(TaskScheduler & taskScheduler) const;
+
+			//! Does the recording half of render(taskScheduler), without touching GL. Call replay() later to make the GL calls.
+			//! Until then, the targets, shaders, meshes, images and uniform buffers used must not be destroyed, but the scenes may change.
+			void record(TaskScheduler & taskScheduler) const;
+
+			//! Makes the GL calls of the last record(). It may be called while the worlds update, since it only reads what was recorded.
+			void replay() const;
+
 			//! Returns the pixel size of the target and the associated images.
 			virtual Vector2i getSize() const = 0;
 
@@ -47,15 +73,36 @@ namespace ve
 			bool flipY;
 
 		private:
+			// Records this target and the targets it depends on, in parallel if there is a task scheduler.
+			void recordTargets(TaskScheduler * taskScheduler) const;
+
+			// Adds the targets this one depends on that haven't been rendered this frame, and then this one, marking them as rendered.
+			void gatherTargetsToRender(std::vector<Target const *> & targets) const;
+
+			// Records the scene into the command list. Doesn't touch GL.
+			void recordCommands() const;
+
+			// Clears the target and replays the command list into it.
+			void replayCommands() const;
+
+			// Returns a count that goes up whenever the scene or the uniform buffers change.
+			unsigned int getChangeCount() const;
+
 			Ptr<Scene> scene;
+			mutable CommandList commands;
+			mutable std::vector<Target const *> recordedTargets; // The targets recorded by the last record(), in the order to replay them.
 			std::function<void(Ptr<Shader> const &)> uniformsFunction;
+			std::vector<Ptr<UniformBuffer>> uniformBuffers;
+			std::function<Frustum()> frustumFunction;
 			mutable bool renderedThisFrame;
+			mutable bool changed = true; // Set by markChanged and cleared when recorded.
+			mutable unsigned int recordedChangeCount = 0; // The change count when last recorded.
 		};
 
 		class WindowTarget : public Target
 		{
 		public:
-			//! Constructs the window stage.
+			//! Constructs the window stage. If sdlWindow is null, the target is headless, for the null backend.
 			WindowTarget(void * sdlWindow);
 
 			//! Destructs the window stage.
@@ -78,6 +125,7 @@ namespace ve
 			static unsigned int numWindowTargets;
 			static void * glContext;
 			void * sdlWindow;
+			Vector2i headlessSize {800, 600};
 		};
 
 		// An target that writes the output to images.
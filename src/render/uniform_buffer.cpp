@@ -0,0 +1,73 @@
+#include "render/uniform_buffer.hpp"
+#include "render/open_gl.hpp"
+#include "render/state_cache.hpp"
+#include <map>
+#include <cstring>
+
+namespace ve
+{
+	namespace render
+	{
+		std::map<std::string, unsigned int> uniformBlockBindingPoints; // The binding point of each uniform block name.
+
+		UniformBuffer::UniformBuffer(std::string const & blockName)
+		{
+			bindingPoint = getBindingPoint(blockName);
+			numBytes = 0;
+			glGenBuffers(1, &glId);
+		}
+
+		UniformBuffer::~UniformBuffer()
+		{
+			glDeleteBuffers(1, &glId);
+			StateCache::onBufferDeleted(glId);
+		}
+
+		unsigned int UniformBuffer::getBindingPoint() const
+		{
+			return bindingPoint;
+		}
+
+		void UniformBuffer::setData(void const * data, unsigned int numBytes_)
+		{
+			if (numBytes_ == lastData.size() && (numBytes_ == 0 || std::memcmp(&lastData[0], data, numBytes_) == 0))
+			{
+				return;
+			}
+			lastData.assign((uint8_t const *)data, (uint8_t const *)data + numBytes_);
+			changeCount++;
+			StateCache::bindBuffer(GL_UNIFORM_BUFFER, glId);
+			if (numBytes_ == numBytes)
+			{
+				glBufferSubData(GL_UNIFORM_BUFFER, 0, numBytes, data);
+			}
+			else
+			{
+				glBufferData(GL_UNIFORM_BUFFER, numBytes_, data, GL_DYNAMIC_DRAW);
+				numBytes = numBytes_;
+			}
+		}
+
+		void UniformBuffer::bind() const
+		{
+			StateCache::bindUniformBuffer(bindingPoint, glId);
+		}
+
+		unsigned int UniformBuffer::getChangeCount() const
+		{
+			return changeCount;
+		}
+
+		unsigned int UniformBuffer::getBindingPoint(std::string const & blockName)
+		{
+			auto it = uniformBlockBindingPoints.find(blockName);
+			if (it != uniformBlockBindingPoints.end())
+			{
+				return it->second;
+			}
+			unsigned int bindingPoint = (unsigned int)uniformBlockBindingPoints.size();
+			uniformBlockBindingPoints[blockName] = bindingPoint;
+			return bindingPoint;
+		}
+	}
+}
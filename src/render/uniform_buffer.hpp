@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace ve
+{
+	namespace render
+	{
+		// A buffer of uniform values that many shaders read from. Every shader with a uniform block of the same name reads from the buffer bound for that name.
+		// The data must match the std140 layout of the block.
+		class UniformBuffer final
+		{
+		public:
+			// Constructs an empty buffer for the uniform block with the name.
+			UniformBuffer(std::string const & blockName);
+
+			// Destructor.
+			~UniformBuffer();
+
+			// Returns the binding point shared by the shader blocks of the same name.
+			unsigned int getBindingPoint() const;
+
+			// Sets the data of the buffer. Data the same as the last set is skipped.
+			void setData(void const * data, unsigned int numBytes);
+
+			// Sets the data of the buffer from a struct laid out like the block.
+			template <typename T> void setData(T const & data);
+
+			// Internal to renderer. Binds the buffer at its binding point.
+			void bind() const;
+
+			// Internal to renderer. Returns a count that goes up whenever the data changes.
+			unsigned int getChangeCount() const;
+
+			// Internal to renderer. Returns the binding point for the uniform block name, giving it the next free one if it doesn't have one.
+			static unsigned int getBindingPoint(std::string const & blockName);
+
+		private:
+			unsigned int bindingPoint;
+			unsigned int glId;
+			unsigned int numBytes;
+			std::vector<uint8_t> lastData; // A copy of the data last set, to skip setting it again.
+			unsigned int changeCount = 0;
+		};
+
+		template <typename T>
+		void UniformBuffer::setData(T const & data)
+		{
+			setData((void const *)&data, sizeof(T));
+		}
+	}
+}
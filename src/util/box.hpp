@@ -0,0 +1,13 @@
+#pragma once
+
+#include "interval.hpp"
+
+namespace ve
+{
+	typedef Interval<3, int> Boxi;
+	typedef Interval<3, float> Boxf;
+	typedef Interval<3, double> Boxd;
+
+	static_assert(sizeof(Boxf) == 6 * sizeof(float), "Interval is not tightly packed.");
+	static_assert(std::is_trivially_copyable<Boxf>::value, "Interval is not trivially copyable.");
+}
\ No newline at end of file
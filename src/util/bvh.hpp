@@ -0,0 +1,577 @@
+#pragma once
+
+#include "box.hpp"
+#include "sphere.hpp"
+#include "frustum.hpp"
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+namespace ve
+{
+	// A dynamic bounding volume hierarchy of boxes, each with a value, for finding the values in a region without checking all of them.
+	// Each leaf keeps its box enlarged by a margin so that small moves don't change the tree. Moves within the margin cost nothing,
+	// moves just beyond it refit the ancestors, and moves far away reinsert the leaf. When the tree has become much worse than when it was last built, it is rebuilt.
+	template <typename T>
+	class Bvh
+	{
+	public:
+		// Constructs an empty tree. The box of each leaf is enlarged by margin times its largest dimension on every side.
+		Bvh(float margin = 0.1f);
+
+		// Inserts a value with its box and returns the id of its leaf. The id stays the same until it is removed.
+		unsigned int insert(Boxf const & box, T const & value);
+
+		// Removes the leaf.
+		void remove(unsigned int id);
+
+		// Moves the leaf to a new box.
+		void move(unsigned int id, Boxf const & box);
+
+		// Returns the box of the leaf, as given in insert or move.
+		Boxf const & getBox(unsigned int id) const;
+
+		// Returns the value of the leaf.
+		T const & getValue(unsigned int id) const;
+
+		// Returns the number of leaves.
+		unsigned int size() const;
+
+		// Rebuilds the tree from its leaves. This is done automatically when needed, but doing it after many inserts gives a better tree.
+		void rebuild();
+
+		// Appends the values whose boxes overlap the box to results.
+		void findOverlapping(Boxf const & box, std::vector<T> & results) const;
+
+		// Appends the values whose boxes overlap the sphere to results.
+		void findOverlapping(Sphere3f const & sphere, std::vector<T> & results) const;
+
+		// Appends the values whose boxes overlap the frustum to results. Boxes just outside of its corners may be included.
+		void findOverlapping(Frustum const & frustum, std::vector<T> & results) const;
+
+		// Calls function(value, box) for every leaf whose box passes test(box), skipping the subtrees whose bounds fail it. The test must pass any box that contains a box that passes.
+		template <typename Test, typename Function>
+		void traverse(Test const & test, Function const & function) const;
+
+	private:
+		static unsigned int const none = (unsigned int)-1;
+
+		struct Node
+		{
+			Boxf box; // For a leaf, the enlarged box.
+			Boxf leafBox; // For a leaf, the box given.
+			unsigned int parent;
+			unsigned int children[2]; // Both none for a leaf.
+			T value;
+		};
+
+		unsigned int allocateNode();
+		void freeNode(unsigned int node);
+		void insertLeaf(unsigned int leaf);
+		void removeLeaf(unsigned int leaf);
+		void refit(unsigned int node);
+		unsigned int build(unsigned int * leaves, unsigned int count, unsigned int parent);
+		float getCost() const;
+		void checkCost();
+		Boxf enlarged(Boxf const & box) const;
+		static float getArea(Boxf const & box);
+		static bool contains(Boxf const & outer, Boxf const & inner);
+
+		std::vector<Node> nodes;
+		std::vector<unsigned int> freeNodes;
+		unsigned int root;
+		unsigned int numLeaves;
+		float margin;
+		unsigned int numChangesSinceCheck;
+		float costAtRebuild;
+	};
+
+	// Template implementation
+
+	template <typename T>
+	Bvh<T>::Bvh(float margin_)
+	{
+		root = none;
+		numLeaves = 0;
+		margin = margin_;
+		numChangesSinceCheck = 0;
+		costAtRebuild = 0;
+	}
+
+	template <typename T>
+	unsigned int Bvh<T>::insert(Boxf const & box, T const & value)
+	{
+		unsigned int leaf = allocateNode();
+		nodes[leaf].box = enlarged(box);
+		nodes[leaf].leafBox = box;
+		nodes[leaf].value = value;
+		insertLeaf(leaf);
+		numLeaves++;
+		checkCost();
+		return leaf;
+	}
+
+	template <typename T>
+	void Bvh<T>::remove(unsigned int id)
+	{
+		if (id >= nodes.size() || nodes[id].children[0] != none)
+		{
+			throw std::runtime_error("Invalid leaf id. ");
+		}
+		removeLeaf(id);
+		freeNode(id);
+		numLeaves--;
+		checkCost();
+	}
+
+	template <typename T>
+	void Bvh<T>::move(unsigned int id, Boxf const & box)
+	{
+		Node & leaf = nodes[id];
+		leaf.leafBox = box;
+		if (contains(leaf.box, box))
+		{
+			return;
+		}
+		Boxf newBox = enlarged(box);
+		if (newBox.intersects(leaf.box))
+		{
+			// A short move. Keep the leaf where it is and grow or shrink its ancestors.
+			leaf.box = newBox;
+			refit(leaf.parent);
+		}
+		else
+		{
+			removeLeaf(id);
+			nodes[id].box = newBox;
+			insertLeaf(id);
+		}
+		checkCost();
+	}
+
+	template <typename T>
+	Boxf const & Bvh<T>::getBox(unsigned int id) const
+	{
+		return nodes[id].leafBox;
+	}
+
+	template <typename T>
+	T const & Bvh<T>::getValue(unsigned int id) const
+	{
+		return nodes[id].value;
+	}
+
+	template <typename T>
+	unsigned int Bvh<T>::size() const
+	{
+		return numLeaves;
+	}
+
+	template <typename T>
+	void Bvh<T>::rebuild()
+	{
+		std::vector<unsigned int> leaves;
+		leaves.reserve(numLeaves);
+		std::vector<unsigned int> stack;
+		if (root != none)
+		{
+			stack.push_back(root);
+		}
+		while (!stack.empty())
+		{
+			unsigned int node = stack.back();
+			stack.pop_back();
+			if (nodes[node].children[0] == none)
+			{
+				leaves.push_back(node);
+			}
+			else
+			{
+				stack.push_back(nodes[node].children[0]);
+				stack.push_back(nodes[node].children[1]);
+				freeNode(node);
+			}
+		}
+		root = leaves.empty() ? none : build(&leaves[0], (unsigned int)leaves.size(), none);
+		costAtRebuild = getCost();
+		numChangesSinceCheck = 0;
+	}
+
+	template <typename T>
+	void Bvh<T>::findOverlapping(Boxf const & box, std::vector<T> & results) const
+	{
+		traverse([&box](Boxf const & nodeBox)
+		{
+			return nodeBox.intersects(box);
+		}, [&results](T const & value, Boxf const &)
+		{
+			results.push_back(value);
+		});
+	}
+
+	template <typename T>
+	void Bvh<T>::findOverlapping(Sphere3f const & sphere, std::vector<T> & results) const
+	{
+		traverse([&sphere](Boxf const & nodeBox)
+		{
+			return (nodeBox.closest(sphere.center) - sphere.center).normSq() <= sphere.radius * sphere.radius;
+		}, [&results](T const & value, Boxf const &)
+		{
+			results.push_back(value);
+		});
+	}
+
+	template <typename T>
+	void Bvh<T>::findOverlapping(Frustum const & frustum, std::vector<T> & results) const
+	{
+		traverse([&frustum](Boxf const & nodeBox)
+		{
+			return frustum.intersects(nodeBox);
+		}, [&results](T const & value, Boxf const &)
+		{
+			results.push_back(value);
+		});
+	}
+
+	template <typename T> template <typename Test, typename Function>
+	void Bvh<T>::traverse(Test const & test, Function const & function) const
+	{
+		if (root == none)
+		{
+			return;
+		}
+		unsigned int fixedStack[64];
+		std::vector<unsigned int> stack; // Only used if the tree is deeper than the fixed stack.
+		unsigned int stackSize = 0;
+		fixedStack[stackSize++] = root;
+		while (stackSize > 0)
+		{
+			unsigned int index = (stackSize <= 64) ? fixedStack[stackSize - 1] : stack[stackSize - 65];
+			stackSize--;
+			if (stackSize >= 64)
+			{
+				stack.pop_back();
+			}
+			Node const & node = nodes[index];
+			if (!test(node.box))
+			{
+				continue;
+			}
+			if (node.children[0] == none)
+			{
+				if (test(node.leafBox))
+				{
+					function(node.value, node.leafBox);
+				}
+				continue;
+			}
+			for (unsigned int i = 0; i < 2; i++)
+			{
+				if (stackSize < 64)
+				{
+					fixedStack[stackSize] = node.children[i];
+				}
+				else
+				{
+					stack.push_back(node.children[i]);
+				}
+				stackSize++;
+			}
+		}
+	}
+
+	template <typename T>
+	unsigned int Bvh<T>::allocateNode()
+	{
+		unsigned int node;
+		if (!freeNodes.empty())
+		{
+			node = freeNodes.back();
+			freeNodes.pop_back();
+		}
+		else
+		{
+			node = (unsigned int)nodes.size();
+			nodes.push_back(Node());
+		}
+		nodes[node].parent = none;
+		nodes[node].children[0] = none;
+		nodes[node].children[1] = none;
+		return node;
+	}
+
+	template <typename T>
+	void Bvh<T>::freeNode(unsigned int node)
+	{
+		nodes[node].value = T();
+		freeNodes.push_back(node);
+	}
+
+	template <typename T>
+	void Bvh<T>::insertLeaf(unsigned int leaf)
+	{
+		if (root == none)
+		{
+			root = leaf;
+			nodes[leaf].parent = none;
+			return;
+		}
+
+		// Walk down to the sibling that grows the total surface area the least.
+		Boxf box = nodes[leaf].box;
+		unsigned int sibling = root;
+		while (nodes[sibling].children[0] != none)
+		{
+			float area = getArea(nodes[sibling].box);
+			float combinedArea = getArea(nodes[sibling].box.unionedWith(box));
+			float cost = 2 * combinedArea; // The cost of a new parent of this node and the leaf.
+			float inheritedCost = 2 * (combinedArea - area); // The cost that every node below pays for this node growing.
+			float childCosts[2];
+			for (unsigned int i = 0; i < 2; i++)
+			{
+				Node const & child = nodes[nodes[sibling].children[i]];
+				float childCombinedArea = getArea(child.box.unionedWith(box));
+				childCosts[i] = (child.children[0] == none ? childCombinedArea : childCombinedArea - getArea(child.box)) + inheritedCost;
+			}
+			if (cost < childCosts[0] && cost < childCosts[1])
+			{
+				break;
+			}
+			sibling = nodes[sibling].children[childCosts[0] < childCosts[1] ? 0 : 1];
+		}
+
+		unsigned int oldParent = nodes[sibling].parent;
+		unsigned int newParent = allocateNode();
+		nodes[newParent].parent = oldParent;
+		nodes[newParent].children[0] = sibling;
+		nodes[newParent].children[1] = leaf;
+		nodes[sibling].parent = newParent;
+		nodes[leaf].parent = newParent;
+		if (oldParent == none)
+		{
+			root = newParent;
+		}
+		else
+		{
+			nodes[oldParent].children[nodes[oldParent].children[0] == sibling ? 0 : 1] = newParent;
+		}
+		refit(newParent);
+	}
+
+	template <typename T>
+	void Bvh<T>::removeLeaf(unsigned int leaf)
+	{
+		if (leaf == root)
+		{
+			root = none;
+			return;
+		}
+		// Replace the parent with the sibling.
+		unsigned int parent = nodes[leaf].parent;
+		unsigned int grandParent = nodes[parent].parent;
+		unsigned int sibling = nodes[parent].children[nodes[parent].children[0] == leaf ? 1 : 0];
+		nodes[sibling].parent = grandParent;
+		if (grandParent == none)
+		{
+			root = sibling;
+		}
+		else
+		{
+			nodes[grandParent].children[nodes[grandParent].children[0] == parent ? 0 : 1] = sibling;
+			refit(grandParent);
+		}
+		freeNode(parent);
+		nodes[leaf].parent = none;
+	}
+
+	template <typename T>
+	void Bvh<T>::refit(unsigned int node)
+	{
+		while (node != none)
+		{
+			Node & n = nodes[node];
+			Boxf box = nodes[n.children[0]].box.unionedWith(nodes[n.children[1]].box);
+			if (box.min == n.box.min && box.max == n.box.max)
+			{
+				break; // The ancestors don't change either.
+			}
+			n.box = box;
+			node = n.parent;
+		}
+		numChangesSinceCheck++;
+	}
+
+	template <typename T>
+	unsigned int Bvh<T>::build(unsigned int * leaves, unsigned int count, unsigned int parent)
+	{
+		if (count == 1)
+		{
+			nodes[leaves[0]].parent = parent;
+			return leaves[0];
+		}
+
+		// Split along the longest axis of the centers, choosing among evenly spaced planes the one with the lowest surface area heuristic cost.
+		Vector3f center = (nodes[leaves[0]].box.min + nodes[leaves[0]].box.max) / 2.f;
+		Boxf centerBounds(center, center);
+		for (unsigned int i = 1; i < count; i++)
+		{
+			centerBounds = centerBounds.extendedTo((nodes[leaves[i]].box.min + nodes[leaves[i]].box.max) / 2.f);
+		}
+		Vector3f size = centerBounds.max - centerBounds.min;
+		unsigned int axis = (size[0] >= size[1] && size[0] >= size[2]) ? 0 : (size[1] >= size[2] ? 1 : 2);
+		unsigned int half = count / 2;
+		if (size[axis] > 0 && count > 4)
+		{
+			unsigned int const numBins = 12;
+			float binScale = numBins / size[axis];
+			auto getBin = [&](unsigned int leaf)
+			{
+				float binCenter = (nodes[leaf].box.min[axis] + nodes[leaf].box.max[axis]) / 2.f;
+				unsigned int bin = (unsigned int)((binCenter - centerBounds.min[axis]) * binScale);
+				return bin < numBins ? bin : numBins - 1;
+			};
+			Boxf binBoxes[numBins];
+			unsigned int binCounts[numBins] = {0};
+			for (unsigned int i = 0; i < count; i++)
+			{
+				unsigned int bin = getBin(leaves[i]);
+				binBoxes[bin] = (binCounts[bin] == 0) ? nodes[leaves[i]].box : binBoxes[bin].unionedWith(nodes[leaves[i]].box);
+				binCounts[bin]++;
+			}
+			// Sweep from the right to get the area of each right side, then from the left to find the best plane.
+			float rightAreas[numBins];
+			Boxf rightBox;
+			unsigned int rightCount = 0;
+			for (unsigned int bin = numBins - 1; bin > 0; bin--)
+			{
+				if (binCounts[bin] > 0)
+				{
+					rightBox = (rightCount == 0) ? binBoxes[bin] : rightBox.unionedWith(binBoxes[bin]);
+					rightCount += binCounts[bin];
+				}
+				rightAreas[bin] = rightCount * (rightCount > 0 ? getArea(rightBox) : 0);
+			}
+			float bestCost = 0;
+			unsigned int bestBin = 0;
+			Boxf leftBox;
+			unsigned int leftCount = 0;
+			for (unsigned int bin = 1; bin < numBins; bin++)
+			{
+				if (binCounts[bin - 1] > 0)
+				{
+					leftBox = (leftCount == 0) ? binBoxes[bin - 1] : leftBox.unionedWith(binBoxes[bin - 1]);
+					leftCount += binCounts[bin - 1];
+				}
+				if (leftCount == 0 || leftCount == count)
+				{
+					continue;
+				}
+				float cost = leftCount * getArea(leftBox) + rightAreas[bin];
+				if (bestBin == 0 || cost < bestCost)
+				{
+					bestCost = cost;
+					bestBin = bin;
+				}
+			}
+			if (bestBin != 0)
+			{
+				half = (unsigned int)(std::partition(leaves, leaves + count, [&](unsigned int leaf)
+				{
+					return getBin(leaf) < bestBin;
+				}) - leaves);
+			}
+		}
+		if (half == 0 || half == count || size[axis] <= 0 || count <= 4)
+		{
+			// Fall back to the median, such as when the centers are all the same.
+			half = count / 2;
+			std::nth_element(leaves, leaves + half, leaves + count, [this, axis](unsigned int a, unsigned int b)
+			{
+				return nodes[a].box.min[axis] + nodes[a].box.max[axis] < nodes[b].box.min[axis] + nodes[b].box.max[axis];
+			});
+		}
+
+		unsigned int node = allocateNode();
+		nodes[node].parent = parent;
+		unsigned int child0 = build(leaves, half, node);
+		unsigned int child1 = build(leaves + half, count - half, node);
+		nodes[node].children[0] = child0;
+		nodes[node].children[1] = child1;
+		nodes[node].box = nodes[child0].box.unionedWith(nodes[child1].box);
+		return node;
+	}
+
+	template <typename T>
+	float Bvh<T>::getCost() const
+	{
+		// The surface area heuristic: the expected number of nodes a random ray visits, relative to the root.
+		if (root == none || nodes[root].children[0] == none)
+		{
+			return 0;
+		}
+		float rootArea = getArea(nodes[root].box);
+		if (rootArea <= 0)
+		{
+			return 0;
+		}
+		float cost = 0;
+		std::vector<unsigned int> stack;
+		stack.push_back(root);
+		while (!stack.empty())
+		{
+			Node const & node = nodes[stack.back()];
+			stack.pop_back();
+			if (node.children[0] != none)
+			{
+				cost += getArea(node.box);
+				stack.push_back(node.children[0]);
+				stack.push_back(node.children[1]);
+			}
+		}
+		return cost / rootArea;
+	}
+
+	template <typename T>
+	void Bvh<T>::checkCost()
+	{
+		// Measuring the cost visits every node, so only do it after enough changes to pay for it.
+		if (numChangesSinceCheck < numLeaves / 8 + 32)
+		{
+			return;
+		}
+		numChangesSinceCheck = 0;
+		if (getCost() > costAtRebuild * 1.5f)
+		{
+			rebuild();
+		}
+	}
+
+	template <typename T>
+	Boxf Bvh<T>::enlarged(Boxf const & box) const
+	{
+		Vector3f size = box.max - box.min;
+		float amount = margin * std::max(size[0], std::max(size[1], size[2]));
+		Vector3f offset = {amount, amount, amount};
+		return Boxf(box.min - offset, box.max + offset);
+	}
+
+	template <typename T>
+	float Bvh<T>::getArea(Boxf const & box)
+	{
+		Vector3f size = box.max - box.min;
+		return 2 * (size[0] * size[1] + size[1] * size[2] + size[2] * size[0]);
+	}
+
+	template <typename T>
+	bool Bvh<T>::contains(Boxf const & outer, Boxf const & inner)
+	{
+		for (unsigned int i = 0; i < 3; i++)
+		{
+			if (inner.min[i] < outer.min[i] || outer.max[i] < inner.max[i])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
\ No newline at end of file
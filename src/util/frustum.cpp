@@ -0,0 +1,109 @@
+#include "frustum.hpp"
+
+namespace ve
+{
+	Frustum::Frustum()
+	{
+		for (unsigned int i = 0; i < 6; i++)
+		{
+			planes[i] = {0, 0, 0, 1};
+		}
+	}
+
+	Frustum::Frustum(Matrix44f const & transform)
+	{
+		// Each plane is the last row plus or minus another row, from Gribb and Hartmann's method.
+		for (unsigned int i = 0; i < 6; i++)
+		{
+			unsigned int row = i / 2;
+			float sign = (i % 2 == 0) ? 1.f : -1.f;
+			for (unsigned int col = 0; col < 4; col++)
+			{
+				planes[i][col] = transform(3, col) + sign * transform(row, col);
+			}
+			float length = std::sqrt(planes[i][0] * planes[i][0] + planes[i][1] * planes[i][1] + planes[i][2] * planes[i][2]);
+			if (length > 0)
+			{
+				planes[i] = planes[i] / length;
+			}
+		}
+	}
+
+	Vector4f const & Frustum::getPlane(unsigned int i) const
+	{
+		return planes[i];
+	}
+
+	bool Frustum::intersects(Sphere3f const & sphere) const
+	{
+		for (unsigned int i = 0; i < 6; i++)
+		{
+			if (planes[i][0] * sphere.center[0] + planes[i][1] * sphere.center[1] + planes[i][2] * sphere.center[2] + planes[i][3] < -sphere.radius)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool Frustum::intersects(Boxf const & box) const
+	{
+		// For each plane, test the corner of the box that is farthest along the plane's normal.
+		for (unsigned int i = 0; i < 6; i++)
+		{
+			float distance = planes[i][3];
+			for (unsigned int j = 0; j < 3; j++)
+			{
+				distance += planes[i][j] * (planes[i][j] >= 0 ? box.max[j] : box.min[j]);
+			}
+			if (distance < 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void Frustum::intersects(Vector4f const * spheres, uint8_t * results, unsigned int count) const
+	{
+		unsigned int i = 0;
+#if defined(VE_SIMD_SSE)
+		// Four spheres at a time, transposed so that each register holds one component of all four.
+		__m128 planeA[6], planeB[6], planeC[6], planeD[6];
+		for (unsigned int p = 0; p < 6; p++)
+		{
+			planeA[p] = _mm_set1_ps(planes[p][0]);
+			planeB[p] = _mm_set1_ps(planes[p][1]);
+			planeC[p] = _mm_set1_ps(planes[p][2]);
+			planeD[p] = _mm_set1_ps(planes[p][3]);
+		}
+		__m128 zero = _mm_setzero_ps();
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 x = _mm_loadu_ps(spheres[i + 0].ptr());
+			__m128 y = _mm_loadu_ps(spheres[i + 1].ptr());
+			__m128 z = _mm_loadu_ps(spheres[i + 2].ptr());
+			__m128 r = _mm_loadu_ps(spheres[i + 3].ptr());
+			_MM_TRANSPOSE4_PS(x, y, z, r);
+			__m128 negativeRadius = _mm_sub_ps(zero, r);
+			__m128 inside = _mm_cmplt_ps(r, zero);
+			__m128 notOutside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+			for (unsigned int p = 0; p < 6; p++)
+			{
+				__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(planeA[p], x), _mm_mul_ps(planeB[p], y)), _mm_add_ps(_mm_mul_ps(planeC[p], z), planeD[p]));
+				notOutside = _mm_and_ps(notOutside, _mm_cmpge_ps(distance, negativeRadius));
+			}
+			int mask = _mm_movemask_ps(_mm_or_ps(inside, notOutside));
+			results[i + 0] = (uint8_t)(mask & 1);
+			results[i + 1] = (uint8_t)((mask >> 1) & 1);
+			results[i + 2] = (uint8_t)((mask >> 2) & 1);
+			results[i + 3] = (uint8_t)((mask >> 3) & 1);
+		}
+#endif
+		for (; i < count; i++)
+		{
+			Vector4f const & sphere = spheres[i];
+			results[i] = (sphere[3] < 0 || intersects(Sphere3f(Vector3f {sphere[0], sphere[1], sphere[2]}, sphere[3]))) ? 1 : 0;
+		}
+	}
+}
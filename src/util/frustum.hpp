@@ -0,0 +1,35 @@
+#pragma once
+
+#include "matrix.hpp"
+#include "sphere.hpp"
+#include "box.hpp"
+#include <cstdint>
+
+namespace ve
+{
+	// A convex volume bounded by six planes, such as the view volume of a camera. Each plane is (a, b, c, d) with the inside where ax + by + cz + d >= 0.
+	class Frustum
+	{
+	public:
+		// Constructs a frustum that contains everything.
+		Frustum();
+
+		// Constructs the frustum that transform maps onto the normalized device coordinate cube, such as a camera's world to ndc transform.
+		explicit Frustum(Matrix44f const & transform);
+
+		// Returns the plane at index i, in the order left, right, bottom, top, near, far.
+		Vector4f const & getPlane(unsigned int i) const;
+
+		// Returns true if any part of the sphere is inside the frustum. It may also return true for some spheres just outside of the corners.
+		bool intersects(Sphere3f const & sphere) const;
+
+		// Returns true if any part of the box is inside the frustum. It may also return true for some boxes just outside of the corners.
+		bool intersects(Boxf const & box) const;
+
+		// Sets results[i] to 1 if spheres[i] intersects the frustum and 0 otherwise, for count spheres. Each sphere is the center in xyz and the radius in w. A negative radius always intersects.
+		void intersects(Vector4f const * spheres, uint8_t * results, unsigned int count) const;
+
+	private:
+		Vector4f planes[6];
+	};
+}
@@ -0,0 +1,189 @@
+#include "intersection.hpp"
+#include "matrix.hpp" // For the SIMD defines.
+
+namespace ve
+{
+	namespace intersection
+	{
+		RayPacket::RayPacket(Ray3f const * rays, unsigned int count)
+		{
+			mask = 0;
+			for (unsigned int i = 0; i < 4; i++)
+			{
+				Ray3f const & ray = rays[i < count ? i : 0];
+				startX[i] = ray.start[0];
+				startY[i] = ray.start[1];
+				startZ[i] = ray.start[2];
+				inverseOffsetX[i] = 1.f / ray.offset[0];
+				inverseOffsetY[i] = 1.f / ray.offset[1];
+				inverseOffsetZ[i] = 1.f / ray.offset[2];
+				if (i < count)
+				{
+					mask |= 1 << i;
+				}
+			}
+		}
+
+		float rayBox(Ray3f const & ray, Boxf const & box, float maxFraction)
+		{
+			// The slab method: the ray is in the box where it is between the planes of every axis.
+			float enter = 0;
+			float exit = maxFraction;
+			for (unsigned int i = 0; i < 3; i++)
+			{
+				float inverseOffset = 1.f / ray.offset[i];
+				float t0 = (box.min[i] - ray.start[i]) * inverseOffset;
+				float t1 = (box.max[i] - ray.start[i]) * inverseOffset;
+				if (t0 > t1)
+				{
+					std::swap(t0, t1);
+				}
+				enter = t0 > enter ? t0 : enter;
+				exit = t1 < exit ? t1 : exit;
+				if (enter > exit)
+				{
+					return -1;
+				}
+			}
+			return enter;
+		}
+
+		unsigned int rayPacketBox(RayPacket const & packet, float const * maxFractions, Boxf const & box)
+		{
+#if defined(VE_SIMD_SSE)
+			__m128 t0 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.min[0]), _mm_loadu_ps(packet.startX)), _mm_loadu_ps(packet.inverseOffsetX));
+			__m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.max[0]), _mm_loadu_ps(packet.startX)), _mm_loadu_ps(packet.inverseOffsetX));
+			__m128 enter = _mm_max_ps(_mm_setzero_ps(), _mm_min_ps(t0, t1));
+			__m128 exit = _mm_min_ps(_mm_loadu_ps(maxFractions), _mm_max_ps(t0, t1));
+			t0 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.min[1]), _mm_loadu_ps(packet.startY)), _mm_loadu_ps(packet.inverseOffsetY));
+			t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.max[1]), _mm_loadu_ps(packet.startY)), _mm_loadu_ps(packet.inverseOffsetY));
+			enter = _mm_max_ps(enter, _mm_min_ps(t0, t1));
+			exit = _mm_min_ps(exit, _mm_max_ps(t0, t1));
+			t0 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.min[2]), _mm_loadu_ps(packet.startZ)), _mm_loadu_ps(packet.inverseOffsetZ));
+			t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.max[2]), _mm_loadu_ps(packet.startZ)), _mm_loadu_ps(packet.inverseOffsetZ));
+			enter = _mm_max_ps(enter, _mm_min_ps(t0, t1));
+			exit = _mm_min_ps(exit, _mm_max_ps(t0, t1));
+			return (unsigned int)_mm_movemask_ps(_mm_cmple_ps(enter, exit)) & packet.mask;
+#else
+			unsigned int result = 0;
+			for (unsigned int i = 0; i < 4; i++)
+			{
+				if (packet.mask & (1 << i))
+				{
+					Ray3f ray(Vector3f {packet.startX[i], packet.startY[i], packet.startZ[i]}, Vector3f {1.f / packet.inverseOffsetX[i], 1.f / packet.inverseOffsetY[i], 1.f / packet.inverseOffsetZ[i]});
+					if (rayBox(ray, box, maxFractions[i]) >= 0)
+					{
+						result |= 1 << i;
+					}
+				}
+			}
+			return result;
+#endif
+		}
+
+		bool rayTriangles(Ray3f const & ray, Vector3f const * positions, unsigned int const * indices, unsigned int numTriangles, float & fraction, unsigned int & triangle)
+		{
+			// The Moller-Trumbore test, with the triangle's barycentric coordinates u and v.
+			float const epsilon = 1e-12f;
+			bool hit = false;
+			unsigned int i = 0;
+#if defined(VE_SIMD_SSE)
+			// Four triangles at a time, each register holding one component of all four.
+			__m128 startX = _mm_set1_ps(ray.start[0]), startY = _mm_set1_ps(ray.start[1]), startZ = _mm_set1_ps(ray.start[2]);
+			__m128 offsetX = _mm_set1_ps(ray.offset[0]), offsetY = _mm_set1_ps(ray.offset[1]), offsetZ = _mm_set1_ps(ray.offset[2]);
+			__m128 zero = _mm_setzero_ps();
+			__m128 one = _mm_set1_ps(1.f);
+			for (; i + 4 <= numTriangles; i += 4)
+			{
+				float v0[3][4], e1[3][4], e2[3][4];
+				for (unsigned int j = 0; j < 4; j++)
+				{
+					Vector3f const & a = positions[indices[(i + j) * 3 + 0]];
+					Vector3f const & b = positions[indices[(i + j) * 3 + 1]];
+					Vector3f const & c = positions[indices[(i + j) * 3 + 2]];
+					for (unsigned int k = 0; k < 3; k++)
+					{
+						v0[k][j] = a[k];
+						e1[k][j] = b[k] - a[k];
+						e2[k][j] = c[k] - a[k];
+					}
+				}
+				__m128 e1X = _mm_loadu_ps(e1[0]), e1Y = _mm_loadu_ps(e1[1]), e1Z = _mm_loadu_ps(e1[2]);
+				__m128 e2X = _mm_loadu_ps(e2[0]), e2Y = _mm_loadu_ps(e2[1]), e2Z = _mm_loadu_ps(e2[2]);
+				// p = offset x e2
+				__m128 pX = _mm_sub_ps(_mm_mul_ps(offsetY, e2Z), _mm_mul_ps(offsetZ, e2Y));
+				__m128 pY = _mm_sub_ps(_mm_mul_ps(offsetZ, e2X), _mm_mul_ps(offsetX, e2Z));
+				__m128 pZ = _mm_sub_ps(_mm_mul_ps(offsetX, e2Y), _mm_mul_ps(offsetY, e2X));
+				__m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1X, pX), _mm_mul_ps(e1Y, pY)), _mm_mul_ps(e1Z, pZ));
+				__m128 inverseDet = _mm_div_ps(one, det);
+				// s = start - v0
+				__m128 sX = _mm_sub_ps(startX, _mm_loadu_ps(v0[0]));
+				__m128 sY = _mm_sub_ps(startY, _mm_loadu_ps(v0[1]));
+				__m128 sZ = _mm_sub_ps(startZ, _mm_loadu_ps(v0[2]));
+				__m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sX, pX), _mm_mul_ps(sY, pY)), _mm_mul_ps(sZ, pZ)), inverseDet);
+				// q = s x e1
+				__m128 qX = _mm_sub_ps(_mm_mul_ps(sY, e1Z), _mm_mul_ps(sZ, e1Y));
+				__m128 qY = _mm_sub_ps(_mm_mul_ps(sZ, e1X), _mm_mul_ps(sX, e1Z));
+				__m128 qZ = _mm_sub_ps(_mm_mul_ps(sX, e1Y), _mm_mul_ps(sY, e1X));
+				__m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(offsetX, qX), _mm_mul_ps(offsetY, qY)), _mm_mul_ps(offsetZ, qZ)), inverseDet);
+				__m128 t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2X, qX), _mm_mul_ps(e2Y, qY)), _mm_mul_ps(e2Z, qZ)), inverseDet);
+				__m128 absDet = _mm_max_ps(det, _mm_sub_ps(zero, det));
+				__m128 valid = _mm_cmpgt_ps(absDet, _mm_set1_ps(epsilon));
+				valid = _mm_and_ps(valid, _mm_cmpge_ps(u, zero));
+				valid = _mm_and_ps(valid, _mm_cmpge_ps(v, zero));
+				valid = _mm_and_ps(valid, _mm_cmple_ps(_mm_add_ps(u, v), one));
+				valid = _mm_and_ps(valid, _mm_cmpge_ps(t, zero));
+				valid = _mm_and_ps(valid, _mm_cmplt_ps(t, _mm_set1_ps(fraction)));
+				int mask = _mm_movemask_ps(valid);
+				if (mask != 0)
+				{
+					float ts[4];
+					_mm_storeu_ps(ts, t);
+					for (unsigned int j = 0; j < 4; j++)
+					{
+						if ((mask & (1 << j)) && ts[j] < fraction)
+						{
+							fraction = ts[j];
+							triangle = i + j;
+							hit = true;
+						}
+					}
+				}
+			}
+#endif
+			for (; i < numTriangles; i++)
+			{
+				Vector3f const & a = positions[indices[i * 3 + 0]];
+				Vector3f e1 = positions[indices[i * 3 + 1]] - a;
+				Vector3f e2 = positions[indices[i * 3 + 2]] - a;
+				Vector3f p = ray.offset.cross(e2);
+				float det = e1.dot(p);
+				if (det > -epsilon && det < epsilon)
+				{
+					continue;
+				}
+				float inverseDet = 1.f / det;
+				Vector3f s = ray.start - a;
+				float u = s.dot(p) * inverseDet;
+				if (u < 0 || u > 1)
+				{
+					continue;
+				}
+				Vector3f q = s.cross(e1);
+				float v = ray.offset.dot(q) * inverseDet;
+				if (v < 0 || u + v > 1)
+				{
+					continue;
+				}
+				float t = e2.dot(q) * inverseDet;
+				if (t >= 0 && t < fraction)
+				{
+					fraction = t;
+					triangle = i;
+					hit = true;
+				}
+			}
+			return hit;
+		}
+	}
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "ray.hpp"
+#include "box.hpp"
+
+namespace ve
+{
+	namespace intersection
+	{
+		//! Four rays arranged component by component so that they can be tested together. Fractions are along each ray's offset.
+		struct RayPacket
+		{
+			//! Prepares count rays, up to four. The missing rays never hit anything.
+			RayPacket(Ray3f const * rays, unsigned int count);
+
+			float startX[4], startY[4], startZ[4];
+			float inverseOffsetX[4], inverseOffsetY[4], inverseOffsetZ[4];
+			unsigned int mask; //< Bit i is set if ray i is present.
+		};
+
+		//! Returns the fraction along the ray's offset where it enters the box, 0 if it starts within it, or -1 if it misses or enters after maxFraction.
+		float rayBox(Ray3f const & ray, Boxf const & box, float maxFraction);
+
+		//! Returns a mask with bit i set if ray i of the packet hits the box before maxFractions[i].
+		unsigned int rayPacketBox(RayPacket const & packet, float const * maxFractions, Boxf const & box);
+
+		//! Tests the ray against numTriangles triangles, each given by three consecutive indices into positions. Both sides of each triangle are hit.
+		//! If the closest hit is before fraction, sets fraction to its fraction and triangle to its index and returns true.
+		bool rayTriangles(Ray3f const & ray, Vector3f const * positions, unsigned int const * indices, unsigned int numTriangles, float & fraction, unsigned int & triangle);
+	}
+}
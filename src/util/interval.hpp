@@ -10,17 +10,23 @@ namespace ve
 	{
 	public:
 		// Constructs with all zeros.
-		Interval();
+		constexpr Interval();
+
+		// Constructs with the elements uninitialized.
+		explicit Interval(Uninitialized);
 
 		// Constructs from the other.
-		Interval(Interval<dim, T> const & other);
+		Interval(Interval<dim, T> const & other) = default;
+
+		// Assigns the other.
+		Interval<dim, T> & operator = (Interval<dim, T> const & other) = default;
 
 		// Constructs from other of a different type.
 		template <typename Y>
 		explicit Interval(Interval<dim, Y> const & other);
 
 		// Constructs to min and max.
-		Interval(Vector<dim, T> min, Vector<dim, T> max);
+		constexpr Interval(Vector<dim, T> min, Vector<dim, T> max);
 
 		// Returns true if every element in v is within the corresponding dimension of the interval.
 		bool contains(Vector<dim, T> v) const;
@@ -60,15 +66,15 @@ namespace ve
 	};
 
 	template <int dim, typename T>
-	Interval<dim, T>::Interval()
+	constexpr Interval<dim, T>::Interval()
+		: min(), max()
 	{
 	}
 
 	template <int dim, typename T>
-	Interval<dim, T>::Interval(Interval<dim, T> const & other)
+	Interval<dim, T>::Interval(Uninitialized)
+		: min(uninitialized), max(uninitialized)
 	{
-		min = other.min;
-		max = other.max;
 	}
 
 	template <int dim, typename T> template <typename Y>
@@ -79,10 +85,9 @@ namespace ve
 	}
 
 	template <int dim, typename T>
-	Interval<dim, T>::Interval(Vector<dim, T> min_, Vector<dim, T> max_)
+	constexpr Interval<dim, T>::Interval(Vector<dim, T> min_, Vector<dim, T> max_)
+		: min(min_), max(max_)
 	{
-		min = min_;
-		max = max_;
 	}
 
 	template <int dim, typename T>
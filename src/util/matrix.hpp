@@ -1,6 +1,22 @@
 #pragma once
 
 #include "vector.hpp"
+#include <cmath>
+#include <utility>
+
+// Matrix44f has SSE and AVX versions of its hot operations. Define VE_NO_SIMD to use the generic versions instead.
+#if !defined(VE_NO_SIMD) && defined(__AVX__)
+#define VE_SIMD_AVX
+#define VE_SIMD_SSE
+#elif !defined(VE_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define VE_SIMD_SSE
+#endif
+
+#if defined(VE_SIMD_AVX)
+#include <immintrin.h>
+#elif defined(VE_SIMD_SSE)
+#include <emmintrin.h>
+#endif
 
 /*
 	This is a standard mathematical matrix class. Rows and cols are the dimensions of the matrix and T is the type of its elements.
@@ -15,17 +31,20 @@ namespace ve
 	class Matrix
 	{
 	public:
-		// Default constructor.
-		Matrix();
+		// Default constructor. Zeroes all elements.
+		constexpr Matrix();
+
+		// Constructor that leaves the elements uninitialized.
+		explicit Matrix(Uninitialized);
 
 		// Copy constructor.
-		Matrix(Matrix<rows, cols, T> const & m);
+		Matrix(Matrix<rows, cols, T> const & m) = default;
 
 		// Initializer list constructor.
 		Matrix(std::initializer_list<T> const & m);
 
 		// Assignment operator.
-		Matrix<rows, cols, T> & operator = (Matrix<rows, cols, T> const & m);
+		Matrix<rows, cols, T> & operator = (Matrix<rows, cols, T> const & m) = default;
 
 		// Set the elements from an initializer list.
 		Matrix<rows, cols, T> const & operator = (std::initializer_list<T> const & m);
@@ -60,9 +79,21 @@ namespace ve
 		// Returns the transpose.
 		Matrix<cols, rows, T> transpose() const;
 
+		// Returns the inverse. Rows must equal cols. Throws if the matrix is not invertible.
+		Matrix<rows, cols, T> inverse() const;
+
 		// Returns this * v, extending v either as a point (v3 = 1) or direction (v3 = 0), and returns the result without the last dimension.
 		Vector<rows - 1, T> transform(Vector<cols - 1, T> v, T v3) const;
 
+		// Does the transform above on count vectors from in, writing them to out. In and out may be the same array.
+		void transform(Vector<cols - 1, T> const * in, Vector<rows - 1, T> * out, unsigned int count, T v3) const;
+
+		// Does the transform above on count vectors stored as separate component arrays, so in[k][n] is component k of vector n. In and out may be the same arrays.
+		void transform(T const * const * in, T * const * out, unsigned int count, T v3) const;
+
+		// Sets out[n] = this * in[n] for count vectors. In and out may be the same array.
+		void transform(Vector<cols, T> const * in, Vector<rows, T> * out, unsigned int count) const;
+
 	private:
 		T c[rows * cols];
 	};
@@ -74,6 +105,10 @@ namespace ve
 	typedef Matrix<4, 4, float> Matrix44f;
 	typedef Matrix<4, 4, double> Matrix44d;
 
+	// The matrices are laid out as plain column-major arrays so that they can be copied as bytes, passed to GL, and serialized in blocks.
+	static_assert(sizeof(Matrix44f) == 16 * sizeof(float) && sizeof(Matrix33d) == 9 * sizeof(double), "Matrix is not tightly packed.");
+	static_assert(std::is_trivially_copyable<Matrix44f>::value, "Matrix is not trivially copyable.");
+
 	// Returns true if each element in m0 is equal to its corresponding element in m1.
 	template <unsigned int rows, unsigned int cols, typename T> bool operator == (Matrix<rows, cols, T> const & m0, Matrix<rows, cols, T> const & m1);
 
@@ -104,16 +139,16 @@ namespace ve
 	// Template Implementations
 
 	template <unsigned int rows, unsigned int cols, typename T>
-	Matrix<rows, cols, T>::Matrix()
+	constexpr Matrix<rows, cols, T>::Matrix()
+		: c()
 	{
 		static_assert(rows > 0 && cols > 0, "rows == 0 || cols == 0");
 	}
 
 	template <unsigned int rows, unsigned int cols, typename T>
-	Matrix<rows, cols, T>::Matrix(Matrix<rows, cols, T> const & m)
+	Matrix<rows, cols, T>::Matrix(Uninitialized)
 	{
 		static_assert(rows > 0 && cols > 0, "rows == 0 || cols == 0");
-		*this = m;
 	}
 
 	template <unsigned int rows, unsigned int cols, typename T>
@@ -123,17 +158,6 @@ namespace ve
 		*this = m;
 	}
 
-	template <unsigned int rows, unsigned int cols, typename T>
-	Matrix<rows, cols, T> & Matrix<rows, cols, T>::operator = (Matrix<rows, cols, T> const & m)
-	{
-		unsigned int size = rows * cols;
-		for (unsigned int i = 0; i < size; ++i)
-		{
-			c[i] = m.c[i];
-		}
-		return *this;
-	}
-
 	template <unsigned int rows, unsigned int cols, typename T>
 	Matrix<rows, cols, T> const & Matrix<rows, cols, T>::operator = (std::initializer_list<T> const & m)
 	{
@@ -153,7 +177,7 @@ namespace ve
 	template <unsigned int rows, unsigned int cols, typename T>
 	Matrix<rows, cols, T> Matrix<rows, cols, T>::zero()
 	{
-		Matrix<rows, cols, T> r;
+		Matrix<rows, cols, T> r(uninitialized);
 		unsigned int size = rows * cols;
 		for (unsigned int i = 0; i < size; ++i)
 		{
@@ -179,7 +203,7 @@ namespace ve
 	Matrix<rows, cols, T> Matrix<rows, cols, T>::crossProduct(Vector<rows, T> v)
 	{
 		static_assert(rows == 3 && cols == 3, "rows != 3 || cols != 3");
-		Matrix<rows, cols, T> r;
+		Matrix<rows, cols, T> r(uninitialized);
 		r.c[0 * rows + 0] = 0;
 		r.c[1 * rows + 0] = -v[2];
 		r.c[2 * rows + 0] = +v[1];
@@ -247,13 +271,64 @@ namespace ve
 	template <unsigned int rows, unsigned int cols, typename T>
 	Matrix<cols, rows, T> Matrix<rows, cols, T>::transpose() const
 	{
-		Matrix<cols, rows, T> r;
+		Matrix<cols, rows, T> r(uninitialized);
 		for (unsigned int i = 0; i < rows; ++i)
 		{
 			unsigned int icols = i * cols;
 			for (unsigned int j = 0; j < cols; ++j)
 			{
-				r(icols + j) = c[j * rows + i];
+				r[icols + j] = c[j * rows + i];
+			}
+		}
+		return r;
+	}
+
+	template <unsigned int rows, unsigned int cols, typename T>
+	Matrix<rows, cols, T> Matrix<rows, cols, T>::inverse() const
+	{
+		static_assert(rows == cols, "rows != cols");
+		// Gauss-Jordan elimination with partial pivoting, applied to a copy of this and to the identity.
+		Matrix<rows, cols, T> a = *this;
+		Matrix<rows, cols, T> r = identity();
+		for (unsigned int col = 0; col < cols; ++col)
+		{
+			unsigned int pivot = col;
+			for (unsigned int row = col + 1; row < rows; ++row)
+			{
+				if (std::abs(a.c[col * rows + row]) > std::abs(a.c[col * rows + pivot]))
+				{
+					pivot = row;
+				}
+			}
+			if (a.c[col * rows + pivot] == (T)0)
+			{
+				throw std::exception();
+			}
+			if (pivot != col)
+			{
+				for (unsigned int k = 0; k < cols; ++k)
+				{
+					std::swap(a.c[k * rows + col], a.c[k * rows + pivot]);
+					std::swap(r.c[k * rows + col], r.c[k * rows + pivot]);
+				}
+			}
+			T scale = (T)1 / a.c[col * rows + col];
+			for (unsigned int k = 0; k < cols; ++k)
+			{
+				a.c[k * rows + col] *= scale;
+				r.c[k * rows + col] *= scale;
+			}
+			for (unsigned int row = 0; row < rows; ++row)
+			{
+				T factor = a.c[col * rows + row];
+				if (row != col && factor != (T)0)
+				{
+					for (unsigned int k = 0; k < cols; ++k)
+					{
+						a.c[k * rows + row] -= factor * a.c[k * rows + col];
+						r.c[k * rows + row] -= factor * r.c[k * rows + col];
+					}
+				}
 			}
 		}
 		return r;
@@ -263,7 +338,7 @@ namespace ve
 	Vector<rows - 1, T> Matrix<rows, cols, T>::transform(Vector<cols - 1, T> v, T v3) const
 	{
 		static_assert(rows == cols && rows > 1, "rows != cols || rows <= 1");
-		Vector<rows - 1, T> r;
+		Vector<rows - 1, T> r(uninitialized);
 		for (unsigned int i = 0; i < rows - 1; ++i)
 		{
 			r[i] = (T)0;
@@ -285,6 +360,46 @@ namespace ve
 		return r;
 	}
 
+	template <unsigned int rows, unsigned int cols, typename T>
+	void Matrix<rows, cols, T>::transform(Vector<cols - 1, T> const * in, Vector<rows - 1, T> * out, unsigned int count, T v3) const
+	{
+		for (unsigned int n = 0; n < count; ++n)
+		{
+			out[n] = transform(in[n], v3);
+		}
+	}
+
+	template <unsigned int rows, unsigned int cols, typename T>
+	void Matrix<rows, cols, T>::transform(T const * const * in, T * const * out, unsigned int count, T v3) const
+	{
+		static_assert(rows == cols && rows > 1, "rows != cols || rows <= 1");
+		for (unsigned int n = 0; n < count; ++n)
+		{
+			T r[rows - 1];
+			for (unsigned int i = 0; i < rows - 1; ++i)
+			{
+				r[i] = c[(cols - 1) * rows + i] * v3;
+				for (unsigned int k = 0; k < cols - 1; ++k)
+				{
+					r[i] += c[k * rows + i] * in[k][n];
+				}
+			}
+			for (unsigned int i = 0; i < rows - 1; ++i)
+			{
+				out[i][n] = r[i];
+			}
+		}
+	}
+
+	template <unsigned int rows, unsigned int cols, typename T>
+	void Matrix<rows, cols, T>::transform(Vector<cols, T> const * in, Vector<rows, T> * out, unsigned int count) const
+	{
+		for (unsigned int n = 0; n < count; ++n)
+		{
+			out[n] = *this * in[n];
+		}
+	}
+
 	template <unsigned int rows, unsigned int cols, typename T>
 	bool operator == (Matrix<rows, cols, T> const & m0, Matrix<rows, cols, T> const & m1)
 	{
@@ -308,7 +423,7 @@ namespace ve
 	template <unsigned int rows, unsigned int cols, typename T>
 	Matrix<rows, cols, T> operator + (Matrix<rows, cols, T> const & m0, Matrix<rows, cols, T> const & m1)
 	{
-		Matrix<rows, cols, T> r;
+		Matrix<rows, cols, T> r(uninitialized);
 		unsigned int size = rows * cols;
 		for (unsigned int i = 0; i < size; ++i)
 		{
@@ -320,7 +435,7 @@ namespace ve
 	template <unsigned int rows, unsigned int cols, typename T>
 	Matrix<rows, cols, T> operator - (Matrix<rows, cols, T> const & m0, Matrix<rows, cols, T> const & m1)
 	{
-		Matrix<rows, cols, T> r;
+		Matrix<rows, cols, T> r(uninitialized);
 		unsigned int size = rows * cols;
 		for (unsigned int i = 0; i < size; ++i)
 		{
@@ -332,7 +447,7 @@ namespace ve
 	template <unsigned int rows, unsigned int mid, unsigned int cols, typename T>
 	Matrix<rows, cols, T> operator * (Matrix<rows, mid, T> const & m0, Matrix<mid, cols, T> const & m1)
 	{
-		Matrix<rows, cols, T> r;
+		Matrix<rows, cols, T> r(uninitialized);
 		for (unsigned int j = 0; j < cols; ++j)
 		{
 			unsigned int jrows = j * rows;
@@ -357,7 +472,7 @@ namespace ve
 	template <unsigned int rows, unsigned int cols, typename T>
 	Matrix<rows, cols, T> operator * (T a, Matrix<rows, cols, T> const & m)
 	{
-		Matrix<rows, cols, T> r;
+		Matrix<rows, cols, T> r(uninitialized);
 		unsigned int size = rows * cols;
 		for (unsigned int i = 0; i < size; ++i)
 		{
@@ -369,7 +484,7 @@ namespace ve
 	template <unsigned int rows, unsigned int cols, typename T>
 	Matrix<rows, cols, T> operator * (Matrix<rows, cols, T> const & m, T a)
 	{
-		Matrix<rows, cols, T> r;
+		Matrix<rows, cols, T> r(uninitialized);
 		unsigned int size = rows * cols;
 		for (unsigned int i = 0; i < size; ++i)
 		{
@@ -381,7 +496,7 @@ namespace ve
 	template <unsigned int rows, unsigned int cols, typename T>
 	Vector<rows, T> operator * (Matrix<rows, cols, T> const & m, Vector<cols, T> v)
 	{
-		Vector<rows, T> r;
+		Vector<rows, T> r(uninitialized);
 		for (unsigned int row = 0; row < rows; ++row)
 		{
 			r[row] = (T)0;
@@ -401,7 +516,7 @@ namespace ve
 	template <unsigned int rows, unsigned int cols, typename T>
 	Vector<cols, T> operator * (Vector<rows, T> v, Matrix<rows, cols, T> const & m)
 	{
-		Vector<cols, T> r;
+		Vector<cols, T> r(uninitialized);
 		for (unsigned int col = 0; col < cols; ++col)
 		{
 			r[col] = (T)0;
@@ -416,4 +531,248 @@ namespace ve
 		}
 		return r;
 	}
+
+	// SIMD Implementations for Matrix44f
+
+#if defined(VE_SIMD_SSE)
+
+	template <>
+	inline Matrix<4, 4, float> Matrix<4, 4, float>::transpose() const
+	{
+		__m128 col0 = _mm_loadu_ps(c + 0);
+		__m128 col1 = _mm_loadu_ps(c + 4);
+		__m128 col2 = _mm_loadu_ps(c + 8);
+		__m128 col3 = _mm_loadu_ps(c + 12);
+		_MM_TRANSPOSE4_PS(col0, col1, col2, col3);
+		Matrix<4, 4, float> r(uninitialized);
+		_mm_storeu_ps(r.c + 0, col0);
+		_mm_storeu_ps(r.c + 4, col1);
+		_mm_storeu_ps(r.c + 8, col2);
+		_mm_storeu_ps(r.c + 12, col3);
+		return r;
+	}
+
+	template <>
+	inline Vector<3, float> Matrix<4, 4, float>::transform(Vector<3, float> v, float v3) const
+	{
+		__m128 r = _mm_mul_ps(_mm_loadu_ps(c + 0), _mm_set1_ps(v[0]));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(c + 4), _mm_set1_ps(v[1])));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(c + 8), _mm_set1_ps(v[2])));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(c + 12), _mm_set1_ps(v3)));
+		float result[4];
+		_mm_storeu_ps(result, r);
+		return {result[0], result[1], result[2]};
+	}
+
+	template <>
+	inline void Matrix<4, 4, float>::transform(Vector<3, float> const * in, Vector<3, float> * out, unsigned int count, float v3) const
+	{
+		__m128 col0 = _mm_loadu_ps(c + 0);
+		__m128 col1 = _mm_loadu_ps(c + 4);
+		__m128 col2 = _mm_loadu_ps(c + 8);
+		__m128 col3 = _mm_mul_ps(_mm_loadu_ps(c + 12), _mm_set1_ps(v3));
+		for (unsigned int n = 0; n < count; ++n)
+		{
+			float const * v = in[n].ptr();
+			__m128 r = _mm_add_ps(col3, _mm_mul_ps(col0, _mm_set1_ps(v[0])));
+			r = _mm_add_ps(r, _mm_mul_ps(col1, _mm_set1_ps(v[1])));
+			r = _mm_add_ps(r, _mm_mul_ps(col2, _mm_set1_ps(v[2])));
+			float * o = out[n].ptr();
+			_mm_storel_pi((__m64 *)o, r);
+			_mm_store_ss(o + 2, _mm_movehl_ps(r, r));
+		}
+	}
+
+	template <>
+	inline void Matrix<4, 4, float>::transform(float const * const * in, float * const * out, unsigned int count, float v3) const
+	{
+		float const * x = in[0];
+		float const * y = in[1];
+		float const * z = in[2];
+		unsigned int n = 0;
+#if defined(VE_SIMD_AVX)
+		for (; n + 8 <= count; n += 8)
+		{
+			__m256 vx = _mm256_loadu_ps(x + n);
+			__m256 vy = _mm256_loadu_ps(y + n);
+			__m256 vz = _mm256_loadu_ps(z + n);
+			for (unsigned int i = 0; i < 3; ++i)
+			{
+				__m256 r = _mm256_set1_ps(c[12 + i] * v3);
+				r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_set1_ps(c[0 + i]), vx));
+				r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_set1_ps(c[4 + i]), vy));
+				r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_set1_ps(c[8 + i]), vz));
+				_mm256_storeu_ps(out[i] + n, r);
+			}
+		}
+#endif
+		for (; n + 4 <= count; n += 4)
+		{
+			__m128 vx = _mm_loadu_ps(x + n);
+			__m128 vy = _mm_loadu_ps(y + n);
+			__m128 vz = _mm_loadu_ps(z + n);
+			for (unsigned int i = 0; i < 3; ++i)
+			{
+				__m128 r = _mm_set1_ps(c[12 + i] * v3);
+				r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(c[0 + i]), vx));
+				r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(c[4 + i]), vy));
+				r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(c[8 + i]), vz));
+				_mm_storeu_ps(out[i] + n, r);
+			}
+		}
+		for (; n < count; ++n)
+		{
+			float vx = x[n];
+			float vy = y[n];
+			float vz = z[n];
+			for (unsigned int i = 0; i < 3; ++i)
+			{
+				out[i][n] = c[12 + i] * v3 + c[0 + i] * vx + c[4 + i] * vy + c[8 + i] * vz;
+			}
+		}
+	}
+
+	template <>
+	inline void Matrix<4, 4, float>::transform(Vector<4, float> const * in, Vector<4, float> * out, unsigned int count) const
+	{
+		__m128 col0 = _mm_loadu_ps(c + 0);
+		__m128 col1 = _mm_loadu_ps(c + 4);
+		__m128 col2 = _mm_loadu_ps(c + 8);
+		__m128 col3 = _mm_loadu_ps(c + 12);
+		for (unsigned int n = 0; n < count; ++n)
+		{
+			float const * v = in[n].ptr();
+			__m128 r = _mm_mul_ps(col0, _mm_set1_ps(v[0]));
+			r = _mm_add_ps(r, _mm_mul_ps(col1, _mm_set1_ps(v[1])));
+			r = _mm_add_ps(r, _mm_mul_ps(col2, _mm_set1_ps(v[2])));
+			r = _mm_add_ps(r, _mm_mul_ps(col3, _mm_set1_ps(v[3])));
+			_mm_storeu_ps(out[n].ptr(), r);
+		}
+	}
+
+	// Uses the 2x2 block method. Since the inverse of the transpose is the transpose of the inverse, the columns can be treated as rows.
+	template <>
+	inline Matrix<4, 4, float> Matrix<4, 4, float>::inverse() const
+	{
+		__m128 col0 = _mm_loadu_ps(c + 0);
+		__m128 col1 = _mm_loadu_ps(c + 4);
+		__m128 col2 = _mm_loadu_ps(c + 8);
+		__m128 col3 = _mm_loadu_ps(c + 12);
+
+		// 2x2 block helpers, each 2x2 matrix stored as (m00, m01, m10, m11).
+		struct Block
+		{
+			static __m128 swizzle(__m128 v, int mask) { return _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(v), mask)); }
+			static __m128 mul(__m128 a, __m128 b) // a * b
+			{
+				return _mm_add_ps(_mm_mul_ps(a, swizzle(b, _MM_SHUFFLE(3, 0, 3, 0))), _mm_mul_ps(swizzle(a, _MM_SHUFFLE(2, 3, 0, 1)), swizzle(b, _MM_SHUFFLE(1, 2, 1, 2))));
+			}
+			static __m128 adjMul(__m128 a, __m128 b) // adj(a) * b
+			{
+				return _mm_sub_ps(_mm_mul_ps(swizzle(a, _MM_SHUFFLE(0, 0, 3, 3)), b), _mm_mul_ps(swizzle(a, _MM_SHUFFLE(2, 2, 1, 1)), swizzle(b, _MM_SHUFFLE(1, 0, 3, 2))));
+			}
+			static __m128 mulAdj(__m128 a, __m128 b) // a * adj(b)
+			{
+				return _mm_sub_ps(_mm_mul_ps(a, swizzle(b, _MM_SHUFFLE(0, 3, 0, 3))), _mm_mul_ps(swizzle(a, _MM_SHUFFLE(2, 3, 0, 1)), swizzle(b, _MM_SHUFFLE(1, 2, 1, 2))));
+			}
+		};
+
+		// The four 2x2 sub-matrices and their determinants.
+		__m128 a = _mm_movelh_ps(col0, col1);
+		__m128 b = _mm_movehl_ps(col1, col0);
+		__m128 cc = _mm_movelh_ps(col2, col3);
+		__m128 d = _mm_movehl_ps(col3, col2);
+		__m128 detSub = _mm_sub_ps(
+			_mm_mul_ps(_mm_shuffle_ps(col0, col2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(col1, col3, _MM_SHUFFLE(3, 1, 3, 1))),
+			_mm_mul_ps(_mm_shuffle_ps(col0, col2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(col1, col3, _MM_SHUFFLE(2, 0, 2, 0))));
+		__m128 detA = Block::swizzle(detSub, _MM_SHUFFLE(0, 0, 0, 0));
+		__m128 detB = Block::swizzle(detSub, _MM_SHUFFLE(1, 1, 1, 1));
+		__m128 detC = Block::swizzle(detSub, _MM_SHUFFLE(2, 2, 2, 2));
+		__m128 detD = Block::swizzle(detSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+		// The adjugates of the blocks of the inverse, each scaled by the determinant.
+		__m128 dc = Block::adjMul(d, cc);
+		__m128 ab = Block::adjMul(a, b);
+		__m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Block::mul(b, dc));
+		__m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Block::mul(cc, ab));
+		__m128 y = _mm_sub_ps(_mm_mul_ps(detB, cc), Block::mulAdj(d, ab));
+		__m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), Block::mulAdj(a, dc));
+
+		// The determinant is |A||D| + |B||C| - tr(adj(A)B adj(D)C).
+		__m128 tr = _mm_mul_ps(ab, Block::swizzle(dc, _MM_SHUFFLE(3, 1, 2, 0)));
+		tr = _mm_add_ps(tr, _mm_movehl_ps(tr, tr));
+		tr = _mm_add_ps(tr, Block::swizzle(tr, _MM_SHUFFLE(1, 1, 1, 1)));
+		__m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), Block::swizzle(tr, _MM_SHUFFLE(0, 0, 0, 0)));
+		if (_mm_cvtss_f32(det) == 0.f)
+		{
+			throw std::exception();
+		}
+		__m128 invDet = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), det);
+		x = _mm_mul_ps(x, invDet);
+		y = _mm_mul_ps(y, invDet);
+		z = _mm_mul_ps(z, invDet);
+		w = _mm_mul_ps(w, invDet);
+
+		// Take the adjugates and put the blocks back together.
+		Matrix<4, 4, float> r(uninitialized);
+		_mm_storeu_ps(r.c + 0, _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3)));
+		_mm_storeu_ps(r.c + 4, _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)));
+		_mm_storeu_ps(r.c + 8, _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3)));
+		_mm_storeu_ps(r.c + 12, _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)));
+		return r;
+	}
+
+	// Returns m0 * m1. Preferred over the template since it is an exact match.
+	inline Matrix<4, 4, float> operator * (Matrix<4, 4, float> const & m0, Matrix<4, 4, float> const & m1)
+	{
+		float const * a = m0.ptr();
+		float const * b = m1.ptr();
+		Matrix<4, 4, float> r(uninitialized);
+#if defined(VE_SIMD_AVX)
+		// Two columns of the result at a time.
+		__m256 col0 = _mm256_broadcast_ps((__m128 const *)(a + 0));
+		__m256 col1 = _mm256_broadcast_ps((__m128 const *)(a + 4));
+		__m256 col2 = _mm256_broadcast_ps((__m128 const *)(a + 8));
+		__m256 col3 = _mm256_broadcast_ps((__m128 const *)(a + 12));
+		for (unsigned int j = 0; j < 4; j += 2)
+		{
+			float const * bj = b + j * 4;
+			__m256 rj = _mm256_mul_ps(col0, _mm256_setr_ps(bj[0], bj[0], bj[0], bj[0], bj[4], bj[4], bj[4], bj[4]));
+			rj = _mm256_add_ps(rj, _mm256_mul_ps(col1, _mm256_setr_ps(bj[1], bj[1], bj[1], bj[1], bj[5], bj[5], bj[5], bj[5])));
+			rj = _mm256_add_ps(rj, _mm256_mul_ps(col2, _mm256_setr_ps(bj[2], bj[2], bj[2], bj[2], bj[6], bj[6], bj[6], bj[6])));
+			rj = _mm256_add_ps(rj, _mm256_mul_ps(col3, _mm256_setr_ps(bj[3], bj[3], bj[3], bj[3], bj[7], bj[7], bj[7], bj[7])));
+			_mm256_storeu_ps(r.ptr() + j * 4, rj);
+		}
+#else
+		__m128 col0 = _mm_loadu_ps(a + 0);
+		__m128 col1 = _mm_loadu_ps(a + 4);
+		__m128 col2 = _mm_loadu_ps(a + 8);
+		__m128 col3 = _mm_loadu_ps(a + 12);
+		for (unsigned int j = 0; j < 4; ++j)
+		{
+			float const * bj = b + j * 4;
+			__m128 rj = _mm_mul_ps(col0, _mm_set1_ps(bj[0]));
+			rj = _mm_add_ps(rj, _mm_mul_ps(col1, _mm_set1_ps(bj[1])));
+			rj = _mm_add_ps(rj, _mm_mul_ps(col2, _mm_set1_ps(bj[2])));
+			rj = _mm_add_ps(rj, _mm_mul_ps(col3, _mm_set1_ps(bj[3])));
+			_mm_storeu_ps(r.ptr() + j * 4, rj);
+		}
+#endif
+		return r;
+	}
+
+	// Returns m * v. Preferred over the template since it is an exact match.
+	inline Vector<4, float> operator * (Matrix<4, 4, float> const & m, Vector<4, float> v)
+	{
+		float const * a = m.ptr();
+		__m128 r = _mm_mul_ps(_mm_loadu_ps(a + 0), _mm_set1_ps(v[0]));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(a + 4), _mm_set1_ps(v[1])));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(a + 8), _mm_set1_ps(v[2])));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(a + 12), _mm_set1_ps(v[3])));
+		Vector<4, float> result(uninitialized);
+		_mm_storeu_ps(result.ptr(), r);
+		return result;
+	}
+
+#endif
 }
\ No newline at end of file
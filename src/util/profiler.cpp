@@ -1,6 +1,7 @@
 #include "profiler.hpp"
 #include <SDL.h>
 #include <fstream>
+#include <mutex>
 #include <stack>
 
 namespace ve
@@ -13,6 +14,7 @@ namespace ve
 
 	std::stack<Sample> samples;
 	std::ofstream profileLog;
+	std::mutex profileLogMutex; // Only needed by addSample, since the other samples are on the main thread.
 
 	float getSeconds()
 	{
@@ -48,6 +50,7 @@ namespace ve
 			spaces += " ";
 		}
 		samples.push({spaces + name, getSeconds()});
+		std::lock_guard<std::mutex> lock(profileLogMutex);
 		profileLog << getSeconds() << samples.top().name << " start" << std::endl;
 	}
 
@@ -59,6 +62,13 @@ namespace ve
 		}
 		Sample sample = samples.top();
 		samples.pop();
+		std::lock_guard<std::mutex> lock(profileLogMutex);
 		profileLog << getSeconds() << sample.name << " " << (getSeconds() - sample.startTime) << std::endl;
 	}
+
+	void Profiler::addSample(std::string const & name, float seconds)
+	{
+		std::lock_guard<std::mutex> lock(profileLogMutex);
+		profileLog << getSeconds() << " " << name << " " << seconds << std::endl;
+	}
 }
\ No newline at end of file
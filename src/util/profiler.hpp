@@ -22,5 +22,8 @@ namespace ve
 
 		//! Ends a sample with the given name.
 		static void endSample();
+
+		//! Writes a sample that was timed by the caller, such as a group of controllers. Unlike the other samples, it may be called from any thread.
+		static void addSample(std::string const & name, float seconds);
 	};
 }
\ No newline at end of file
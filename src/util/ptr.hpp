@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <exception>
+#include <type_traits>
 
 namespace ve
 {
@@ -91,10 +92,10 @@ namespace ve
 		//! Point the pointer to newP, which can have a type that is subclass of T. Only pass in something that looks like 'new T()' to ensure that the raw pointer isn't used elsewhere.
 		template <typename Y> void setRaw(Y * newP, void(*deleteFunction) (Y *) = deleteObject);
 
-		//! Change the object to a new pointer to an object of type T with arguments. Uses the new operator for allocation. For special allocation use the function setRaw().
+		//! Change the object to a new pointer to an object of type T with arguments. The object and its counter share a single allocation. For special allocation use the function setRaw().
 		template <typename ... Args> void setNew(Args && ... args);
 
-		//! Change the object to a new pointer to an object of type Y with arguments. Uses the new operator for allocation. For special allocation the function setRaw().
+		//! Change the object to a new pointer to an object of type Y with arguments. The object and its counter share a single allocation. For special allocation use the function setRaw().
 		template <typename Y, typename ... Args> void setNew(Args && ... args);
 
 		//! Returns a newly created OwnPtr using setNew above.
@@ -175,13 +176,15 @@ namespace ve
 	class _PtrCounter
 	{
 	public:
-		virtual intptr_t hash() = 0; // Used in comparisons and intptr_t casting. Needed because of virtual inheritance.
+		virtual ~_PtrCounter() {}
+
 		virtual void destroy() = 0;
 
+		intptr_t address = 0; // Address of the most derived pointee, used in comparisons and intptr_t casting. Needed because of virtual inheritance. Zero once destroyed.
 		int pc = 1; // OwnPtr and Ptr reference counter
 	};
 
-	// This is used for proper destruction of subclasses of T.
+	// This is used by setRaw for proper destruction of subclasses of T with a user-supplied destroy function.
 	template <typename T>
 	class _PtrCounterTyped : public _PtrCounter
 	{
@@ -190,11 +193,7 @@ namespace ve
 		{
 			this->p = p;
 			this->deleteFunction = deleteFunction;
-		}
-
-		intptr_t hash() override
-		{
-			return (intptr_t)p;
+			address = (intptr_t)p;
 		}
 
 		void destroy() override
@@ -205,12 +204,41 @@ namespace ve
 			}
 			deleteFunction = deleteObject;
 			p = nullptr;
+			address = 0;
 		}
 
 		T * p = nullptr; // Derived type for correct destruction, even without base virtual destructor.
 		void(*deleteFunction) (T *) = deleteObject; // User-supplied destroy function.
 	};
 
+	// This is used by setNew to hold the object in the same allocation as the counter. The memory is freed when the last Ptr lets go.
+	template <typename T>
+	class _PtrCounterInline : public _PtrCounter
+	{
+	public:
+		template <typename ... Args> _PtrCounterInline(Args && ... args)
+		{
+			new (&storage) T(std::forward<Args>(args)...);
+			address = (intptr_t)get();
+		}
+
+		T * get()
+		{
+			return reinterpret_cast<T *>(&storage);
+		}
+
+		void destroy() override
+		{
+			if (address != 0)
+			{
+				get()->~T();
+				address = 0;
+			}
+		}
+
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+	};
+
 	template <typename T>
 	PtrBase<T>::PtrBase()
 	{
@@ -271,7 +299,7 @@ namespace ve
 		{
 			return 0; // The object was destroyed already, so just return 0.
 		}
-		return c->hash();
+		return c->address;
 	}
 
 	template <typename T> template <typename Y>
@@ -310,20 +338,28 @@ namespace ve
 	template <typename T>
 	OwnPtr<T> & OwnPtr<T>::operator = (OwnPtr<T> && ownPtr)
 	{
-		p = ownPtr.p;
-		c = ownPtr.c;
-		ownPtr.p = nullptr;
-		ownPtr.c = nullptr;
+		if ((void *)this != (void *)&ownPtr)
+		{
+			setNull();
+			p = ownPtr.p;
+			c = ownPtr.c;
+			ownPtr.p = nullptr;
+			ownPtr.c = nullptr;
+		}
 		return *this;
 	}
 
 	template <typename T> template <typename Y>
 	OwnPtr<T> & OwnPtr<T>::operator = (OwnPtr<Y> && ownPtr)
 	{
-		p = ownPtr.p;
-		c = ownPtr.c;
-		ownPtr.p = nullptr;
-		ownPtr.c = nullptr;
+		if ((void *)this != (void *)&ownPtr)
+		{
+			setNull();
+			p = ownPtr.p;
+			c = ownPtr.c;
+			ownPtr.p = nullptr;
+			ownPtr.c = nullptr;
+		}
 		return *this;
 	}
 
@@ -373,13 +409,19 @@ namespace ve
 	template <typename T> template <typename ... Args>
 	void OwnPtr<T>::setNew(Args && ... args)
 	{
-		setRaw(new T(std::forward<Args>(args)...));
+		setNull();
+		_PtrCounterInline<T> * counter = new _PtrCounterInline<T>(std::forward<Args>(args)...);
+		p = counter->get();
+		c = counter;
 	}
 
 	template <typename T> template <typename Y, typename ... Args>
 	void OwnPtr<T>::setNew(Args && ... args)
 	{
-		setRaw(new Y(std::forward<Args>(args)...));
+		setNull();
+		_PtrCounterInline<Y> * counter = new _PtrCounterInline<Y>(std::forward<Args>(args)...);
+		p = counter->get();
+		c = counter;
 	}
 
 	template <typename T> template <typename ... Args>
@@ -1,12 +1,15 @@
 #pragma once
 
 #include "ptr.hpp"
-#include <map>
-#include <set>
+#include <unordered_map>
+#include <vector>
 #include <functional>
+#include <type_traits>
 
 namespace ve
 {
+	// A set of owned pointers stored densely in a vector. Erasing is deferred until processEraseQueue(), where the last element is moved into the hole.
+	// Iteration is in insertion order until an erase, after which the moved elements take the erased positions.
 	template <typename T>
 	class PtrSet
 	{
@@ -15,6 +18,13 @@ namespace ve
 		class iterator;
 		class const_iterator;
 
+		// A handle to an element. It remains valid while the element is in the set, and it becomes invalid (rather than referring to a different element) once it is erased.
+		struct Handle
+		{
+			unsigned int slot = 0;
+			unsigned int generation = 0;
+		};
+
 		// Default constructor.
 		PtrSet();
 
@@ -25,12 +35,27 @@ namespace ve
 		// Queues the element for erase at next processEraseQueue().
 		void queueForErase(Ptr<T> const & ptr);
 
+		// Queues the element for erase at next processEraseQueue(). Does nothing if the handle is no longer valid.
+		void queueForErase(Handle handle);
+
 		// Returns the iterator of a given element, or end if it is not found.
 		iterator find(Ptr<T> const & ptr) const;
 
+		// Returns the handle of a given element. If it is not found, the handle will not be valid.
+		Handle getHandle(Ptr<T> const & ptr) const;
+
+		// Returns the handle of the element at the given address, which may be that of a base of the element. If it is not found, the handle will not be valid.
+		Handle getHandle(T const * element) const;
+
+		// Returns the element of the handle, or null if the handle is no longer valid.
+		Ptr<T> get(Handle handle) const;
+
 		// Returns true if there there are no elements.
 		bool empty() const;
 
+		// Returns the number of elements.
+		unsigned int size() const;
+
 		// Queues all elements for erase at the next processEraseQueue().
 		void queueAllForErase();
 
@@ -40,17 +65,35 @@ namespace ve
 		// Processes any erased elements that have accumulated since the last call.
 		void processEraseQueue();
 
-		// Iterators.
+		// Iterators. Elements inserted during iteration are not visited by iterators that were already created.
 		iterator begin();
 		iterator end();
 		const_iterator begin() const;
 		const_iterator end() const;
 
 	private:
-		class Hash;
-		std::set<OwnPtr<T>> set;
-		std::map<Ptr<T>, typename std::set<OwnPtr<T>>::const_iterator> lookup;
-		std::set<Ptr<T>> eraseQueue;
+		struct Slot
+		{
+			unsigned int element; // Index in elements. Only meaningful when inUse.
+			unsigned int generation = 1; // Starts at 1 so that a default Handle is never valid.
+			bool inUse = false;
+			bool queuedForErase = false;
+		};
+
+		Slot const * getSlot(Handle handle) const;
+
+		Handle getHandleAtAddress(intptr_t address) const;
+
+		// Returns the address of the most derived object, which is what the lookup uses, since T may not be at the start of it.
+		static intptr_t getAddress(T const * element, std::true_type isPolymorphic);
+		static intptr_t getAddress(T const * element, std::false_type isPolymorphic);
+
+		std::vector<OwnPtr<T>> elements;
+		std::vector<unsigned int> elementSlots; // The slot of each element, parallel to elements.
+		std::vector<Slot> slots;
+		std::vector<unsigned int> freeSlots;
+		std::unordered_map<intptr_t, unsigned int> lookup; // Pointee address to slot.
+		std::vector<unsigned int> eraseQueue; // Slots.
 	};
 
 	//  Implementation
@@ -59,15 +102,16 @@ namespace ve
 	class PtrSet<T>::iterator
 	{
 	public:
-		iterator(typename std::set<OwnPtr<T>>::iterator const & iter_) : iter(iter_) {}
-		iterator operator ++ () { ++iter; return *this; }
-		iterator operator ++ (int junk) { iterator i = *this; iter++; return i; }
-		Ptr<T> operator * () { return *iter; }
-		bool operator == (iterator const & rhs) { return iter == rhs.iter; }
-		bool operator != (iterator const & rhs) { return iter != rhs.iter; }
+		iterator(std::vector<OwnPtr<T>> const * elements_, unsigned int index_) : elements(elements_), index(index_) {}
+		iterator operator ++ () { ++index; return *this; }
+		iterator operator ++ (int junk) { iterator i = *this; index++; return i; }
+		Ptr<T> operator * () { return (*elements)[index]; }
+		bool operator == (iterator const & rhs) { return index == rhs.index; }
+		bool operator != (iterator const & rhs) { return index != rhs.index; }
 
 	private:
-		typename std::set<OwnPtr<T>>::iterator iter;
+		std::vector<OwnPtr<T>> const * elements;
+		unsigned int index;
 		friend class const_iterator;
 	};
 
@@ -75,16 +119,17 @@ namespace ve
 	class PtrSet<T>::const_iterator
 	{
 	public:
-		const_iterator(typename std::set<OwnPtr<T>>::const_iterator const & iter_) : iter(iter_) {}
-		const_iterator(iterator const & iter) : iter(iter.iter) {}
-		const_iterator operator ++ () { ++iter; return *this; }
-		const_iterator operator ++ (int junk) { const_iterator i = *this; iter++; return i; }
-		Ptr<T> operator * () { return *iter; }
-		bool operator == (const_iterator const & rhs) { return iter == rhs.iter; }
-		bool operator != (const_iterator const & rhs) { return iter != rhs.iter; }
+		const_iterator(std::vector<OwnPtr<T>> const * elements_, unsigned int index_) : elements(elements_), index(index_) {}
+		const_iterator(iterator const & iter) : elements(iter.elements), index(iter.index) {}
+		const_iterator operator ++ () { ++index; return *this; }
+		const_iterator operator ++ (int junk) { const_iterator i = *this; index++; return i; }
+		Ptr<T> operator * () { return (*elements)[index]; }
+		bool operator == (const_iterator const & rhs) { return index == rhs.index; }
+		bool operator != (const_iterator const & rhs) { return index != rhs.index; }
 
 	private:
-		typename std::set<OwnPtr<T>>::const_iterator iter;
+		std::vector<OwnPtr<T>> const * elements;
+		unsigned int index;
 	};
 
 	template <typename T>
@@ -97,35 +142,123 @@ namespace ve
 	{
 		auto ownPtr = OwnPtr<Y>::returnNew(std::forward<Args>(args)...);
 		Ptr<Y> ptr = ownPtr;
-		lookup[ptr] = set.insert(std::move(ownPtr)).first;
+		unsigned int slot;
+		if (!freeSlots.empty())
+		{
+			slot = freeSlots.back();
+			freeSlots.pop_back();
+		}
+		else
+		{
+			slot = (unsigned int)slots.size();
+			slots.push_back(Slot());
+		}
+		slots[slot].element = (unsigned int)elements.size();
+		slots[slot].inUse = true;
+		slots[slot].queuedForErase = false;
+		elements.push_back(std::move(ownPtr));
+		elementSlots.push_back(slot);
+		lookup[(intptr_t)ptr] = slot;
 		return ptr;
 	}
 
 	template <typename T>
 	void PtrSet<T>::queueForErase(Ptr<T> const & ptr)
 	{
-		eraseQueue.insert(ptr);
+		queueForErase(getHandle(ptr));
+	}
+
+	template <typename T>
+	void PtrSet<T>::queueForErase(Handle handle)
+	{
+		if (getSlot(handle) != nullptr && !slots[handle.slot].queuedForErase)
+		{
+			slots[handle.slot].queuedForErase = true;
+			eraseQueue.push_back(handle.slot);
+		}
 	}
 
 	template <typename T>
 	typename PtrSet<T>::iterator PtrSet<T>::find(Ptr<T> const & ptr) const
 	{
-		return iterator(lookup.find(ptr));
+		auto it = lookup.find((intptr_t)ptr);
+		if (it == lookup.end())
+		{
+			return iterator(&elements, (unsigned int)elements.size());
+		}
+		return iterator(&elements, slots[it->second].element);
+	}
+
+	template <typename T>
+	typename PtrSet<T>::Handle PtrSet<T>::getHandle(Ptr<T> const & ptr) const
+	{
+		return getHandleAtAddress((intptr_t)ptr); // The address is null if the element was destroyed.
+	}
+
+	template <typename T>
+	typename PtrSet<T>::Handle PtrSet<T>::getHandle(T const * element) const
+	{
+		return getHandleAtAddress(getAddress(element, std::is_polymorphic<T>()));
+	}
+
+	template <typename T>
+	typename PtrSet<T>::Handle PtrSet<T>::getHandleAtAddress(intptr_t address) const
+	{
+		Handle handle;
+		auto it = lookup.find(address);
+		if (it != lookup.end())
+		{
+			handle.slot = it->second;
+			handle.generation = slots[it->second].generation;
+		}
+		return handle;
+	}
+
+	template <typename T>
+	intptr_t PtrSet<T>::getAddress(T const * element, std::true_type)
+	{
+		return (intptr_t)dynamic_cast<void const *>(element);
+	}
+
+	template <typename T>
+	intptr_t PtrSet<T>::getAddress(T const * element, std::false_type)
+	{
+		return (intptr_t)element;
+	}
+
+	template <typename T>
+	Ptr<T> PtrSet<T>::get(Handle handle) const
+	{
+		Slot const * slot = getSlot(handle);
+		if (slot == nullptr)
+		{
+			return Ptr<T>();
+		}
+		return elements[slot->element];
 	}
 
 	template <typename T>
 	bool PtrSet<T>::empty() const
 	{
-		return set.empty();
+		return elements.empty();
+	}
+
+	template <typename T>
+	unsigned int PtrSet<T>::size() const
+	{
+		return (unsigned int)elements.size();
 	}
 
 	template <typename T>
 	void PtrSet<T>::queueAllForErase()
 	{
-		eraseQueue.clear();
-		for (auto it = set.begin(); it != set.end(); ++it)
+		for (auto slot : elementSlots)
 		{
-			eraseQueue.insert(*it);
+			if (!slots[slot].queuedForErase)
+			{
+				slots[slot].queuedForErase = true;
+				eraseQueue.push_back(slot);
+			}
 		}
 	}
 
@@ -138,49 +271,65 @@ namespace ve
 	template <typename T>
 	void PtrSet<T>::processEraseQueue()
 	{
-		for (auto ptr : eraseQueue)
+		// Destroying an element may queue more elements, so work on a local queue until no more are added.
+		while (!eraseQueue.empty())
 		{
-			auto it = lookup.find(ptr);
-			if (it != lookup.end())
+			std::vector<unsigned int> queue;
+			queue.swap(eraseQueue);
+			for (auto slot : queue)
 			{
-				set.erase(it->second);
+				unsigned int index = slots[slot].element;
+				OwnPtr<T> erased = std::move(elements[index]);
+				unsigned int last = (unsigned int)elements.size() - 1;
+				if (index != last)
+				{
+					elements[index] = std::move(elements[last]);
+					elementSlots[index] = elementSlots[last];
+					slots[elementSlots[index]].element = index;
+				}
+				elements.pop_back();
+				elementSlots.pop_back();
+				lookup.erase((intptr_t)erased);
+				slots[slot].inUse = false;
+				slots[slot].queuedForErase = false;
+				slots[slot].generation++;
+				freeSlots.push_back(slot);
+				// The element is destroyed here, after the set is consistent again.
 			}
-			lookup.erase(ptr);
 		}
-		eraseQueue.clear();
 	}
 
 	template <typename T>
 	typename PtrSet<T>::iterator PtrSet<T>::begin()
 	{
-		return iterator(set.begin());
+		return iterator(&elements, 0);
 	}
 
 	template <typename T>
 	typename PtrSet<T>::iterator PtrSet<T>::end()
 	{
-		return iterator(set.end());
+		return iterator(&elements, (unsigned int)elements.size());
 	}
 
 	template <typename T>
 	typename PtrSet<T>::const_iterator PtrSet<T>::begin() const
 	{
-		return const_iterator(set.cbegin());
+		return const_iterator(&elements, 0);
 	}
 
 	template <typename T>
 	typename PtrSet<T>::const_iterator PtrSet<T>::end() const
 	{
-		return const_iterator(set.cend());
+		return const_iterator(&elements, (unsigned int)elements.size());
 	}
 
 	template <typename T>
-	class PtrSet<T>::Hash
+	typename PtrSet<T>::Slot const * PtrSet<T>::getSlot(Handle handle) const
 	{
-	public:
-		size_t operator () (T const & t) const
+		if (handle.slot >= slots.size() || !slots[handle.slot].inUse || slots[handle.slot].generation != handle.generation)
 		{
-			return (size_t)t;
+			return nullptr;
 		}
-	};
-}
\ No newline at end of file
+		return &slots[handle.slot];
+	}
+}
@@ -10,13 +10,16 @@ namespace ve
 	{
 	public:
 		// Constructs it as the identity.
-		Quaternion();
+		constexpr Quaternion();
+
+		// Constructs it with the elements uninitialized.
+		explicit Quaternion(Uninitialized);
 
 		// Constructs it with specific numbers.
 		Quaternion(T r, T i, T j, T k);
 
 		// Constructs it with a real and imaginary part.
-		Quaternion(T r, Vector<3, T> ijk);
+		constexpr Quaternion(T r, Vector<3, T> ijk);
 
 		// Constructs it with an angle and axis. If axisIsNormalized is true, the axis will not be normalized.
 		Quaternion(T angle, Vector<3, T> const & axis, bool axisIsNormalized);
@@ -61,6 +64,9 @@ namespace ve
 	typedef Quaternion<float> Quaternionf;
 	typedef Quaternion<double> Quaterniond;
 
+	static_assert(sizeof(Quaternionf) == 4 * sizeof(float), "Quaternion is not tightly packed.");
+	static_assert(std::is_trivially_copyable<Quaternionf>::value, "Quaternion is not trivially copyable.");
+
 	// Returns the addition of two quaternions.
 	template <typename T> Quaternion<T> operator + (Quaternion<T> const & q_lhs, Quaternion<T> const & q_rhs);
 
@@ -76,27 +82,34 @@ namespace ve
 	// Returns the multiplication of a scalar and a quaternion.
 	template <typename T> Quaternion<T> operator * (T t, Quaternion<T> const & q);
 
+	// Returns the normalized linear interpolation from q0 at t = 0 to q1 at t = 1, the short way around. Assumes both are normalized.
+	template <typename T> Quaternion<T> nlerp(Quaternion<T> const & q0, Quaternion<T> const & q1, T t);
+
 	// Template implementation
 
 	template <typename T>
-	Quaternion<T>::Quaternion()
+	constexpr Quaternion<T>::Quaternion()
+		: r(1), ijk()
+	{
+	}
+
+	template <typename T>
+	Quaternion<T>::Quaternion(Uninitialized)
+		: ijk(uninitialized)
 	{
-		r = 1;
-		ijk = { 0, 0, 0 };
 	}
 
 	template <typename T>
 	Quaternion<T>::Quaternion(T r_, T i, T j, T k)
 	{
-		r = r;
+		r = r_;
 		ijk = { i, j, k };
 	}
 
 	template <typename T>
-	Quaternion<T>::Quaternion(T r_, Vector<3, T> ijk_)
+	constexpr Quaternion<T>::Quaternion(T r_, Vector<3, T> ijk_)
+		: r(r_), ijk(ijk_)
 	{
-		r = r_;
-		ijk = ijk_;
 	}
 
 	template <typename T>
@@ -192,7 +205,7 @@ namespace ve
 			throw std::exception();
 		}
 		r /= n;
-		ijk /= n;
+		ijk *= (T)1 / n;
 	}
 
 	template <typename T>
@@ -272,5 +285,15 @@ namespace ve
 	{
 		return Quaternion<T>(t * q.r, t * q.ijk);
 	}
+
+	template <typename T>
+	Quaternion<T> nlerp(Quaternion<T> const & q0, Quaternion<T> const & q1, T t)
+	{
+		// q and -q are the same rotation, so flip q1 if it is on the far side of q0.
+		T sign = (q0.r * q1.r + q0.ijk.dot(q1.ijk) < 0) ? (T)-1 : (T)1;
+		Quaternion<T> q = q0 * ((T)1 - t) + q1 * (sign * t);
+		q.normalize();
+		return q;
+	}
 }
 
@@ -7,4 +7,7 @@ namespace ve
 	typedef Interval<2, int> Recti;
 	typedef Interval<2, float> Rectf;
 	typedef Interval<2, double> Rectd;
+
+	static_assert(sizeof(Recti) == 4 * sizeof(int), "Interval is not tightly packed.");
+	static_assert(std::is_trivially_copyable<Rectf>::value, "Interval is not trivially copyable.");
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <exception>
 #include <string>
 #include <vector>
+#include <type_traits>
 
 namespace ve
 {
@@ -109,6 +110,40 @@ namespace ve
 		deserialize(in, (void *)&v[0], size);
 	}
 
+	// Serialize count trivially copyable items, such as vectors and matrices, as a single block of bytes.
+	template <class T>
+	void serializeBlock(std::ostream & out, T const * items, int count)
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "T is not trivially copyable.");
+		serialize(out, (void const *)items, count * (int)sizeof(T));
+	}
+
+	// Deserialize count trivially copyable items from a single block of bytes.
+	template <class T>
+	void deserializeBlock(std::istream & in, T * items, int count)
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "T is not trivially copyable.");
+		deserialize(in, (void *)items, count * (int)sizeof(T));
+	}
+
+	// Serialize a vector of trivially copyable items as its size and a single block of bytes.
+	template <class T>
+	void serializeBlock(std::ostream & out, std::vector<T> const & v)
+	{
+		serialize(out, (int)v.size());
+		serializeBlock(out, v.data(), (int)v.size());
+	}
+
+	// Deserialize a vector of trivially copyable items from its size and a single block of bytes.
+	template <class T>
+	void deserializeBlock(std::istream & in, std::vector<T> & v)
+	{
+		int size;
+		deserialize(in, size);
+		v.resize((size_t)size);
+		deserializeBlock(in, v.data(), size);
+	}
+
 	// Serialize a vector of items using a serialize function for each item.
 	template <class T>
 	void serialize(std::ostream & out, std::vector<T> const & v, void(*serializeItem)(std::ostream &, T const &) = serialize)
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "vector.hpp"
+
+namespace ve
+{
+	// A sphere is a center and a radius.
+	template <unsigned int dim, typename T>
+	class Sphere
+	{
+	public:
+		// Constructs a sphere with the center and radius zeroed.
+		Sphere();
+
+		// Constructs a sphere with the center and radius specified.
+		Sphere(Vector<dim, T> center, T radius);
+
+		// Returns true if p is within the sphere.
+		bool contains(Vector<dim, T> p) const;
+
+		// The center of the sphere.
+		Vector<dim, T> center;
+
+		// The radius of the sphere.
+		T radius;
+	};
+
+	typedef Sphere<2, float> Sphere2f;
+	typedef Sphere<2, double> Sphere2d;
+	typedef Sphere<3, float> Sphere3f;
+	typedef Sphere<3, double> Sphere3d;
+
+	// Template implementation
+
+	template <unsigned int dim, typename T>
+	Sphere<dim, T>::Sphere()
+	{
+		radius = 0;
+	}
+
+	template <unsigned int dim, typename T>
+	Sphere<dim, T>::Sphere(Vector<dim, T> newCenter, T newRadius)
+	{
+		center = newCenter;
+		radius = newRadius;
+	}
+
+	template <unsigned int dim, typename T>
+	bool Sphere<dim, T>::contains(Vector<dim, T> p) const
+	{
+		return (p - center).normSq() <= radius * radius;
+	}
+}
\ No newline at end of file
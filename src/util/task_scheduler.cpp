@@ -0,0 +1,337 @@
+#include "util/task_scheduler.hpp"
+#include <memory>
+#include <stdexcept>
+
+namespace ve
+{
+	// The scheduler and queue of the current thread if it is a worker.
+	thread_local TaskScheduler const * currentScheduler = nullptr;
+	thread_local unsigned int currentQueueIndex = 0;
+
+	TaskScheduler::TaskScheduler(unsigned int numThreads)
+	{
+		if (numThreads == 0)
+		{
+			numThreads = std::thread::hardware_concurrency();
+			if (numThreads == 0)
+			{
+				numThreads = 1;
+			}
+		}
+		numQueued = 0;
+		stopping = false;
+		queues = std::vector<Queue>(numThreads);
+		for (unsigned int i = 1; i < numThreads; i++)
+		{
+			workers.push_back(std::thread(&TaskScheduler::workerLoop, this, i));
+		}
+	}
+
+	TaskScheduler::~TaskScheduler()
+	{
+		{
+			std::lock_guard<std::mutex> lock(sleepMutex);
+			stopping = true;
+		}
+		sleepCondition.notify_all();
+		for (auto && worker : workers)
+		{
+			worker.join();
+		}
+	}
+
+	unsigned int TaskScheduler::getNumThreads() const
+	{
+		return (unsigned int)queues.size();
+	}
+
+	void TaskScheduler::parallelFor(unsigned int begin, unsigned int end, std::function<void(unsigned int index)> const & function, unsigned int grainSize)
+	{
+		if (begin >= end)
+		{
+			return;
+		}
+		if (grainSize == 0)
+		{
+			grainSize = 1;
+		}
+		// Use a few chunks per thread so that stealing can even out uneven chunks.
+		unsigned int numChunks = (end - begin + grainSize - 1) / grainSize;
+		if (numChunks > getNumThreads() * 4)
+		{
+			numChunks = getNumThreads() * 4;
+		}
+		if (numChunks <= 1 || getNumThreads() == 1)
+		{
+			for (unsigned int i = begin; i < end; i++)
+			{
+				function(i);
+			}
+			return;
+		}
+		unsigned int chunkSize = (end - begin + numChunks - 1) / numChunks;
+		Group group;
+		group.numPending = 0;
+		group.failed = false;
+		for (unsigned int chunkBegin = begin; chunkBegin < end; chunkBegin += chunkSize)
+		{
+			unsigned int chunkEnd = (end - chunkBegin > chunkSize) ? chunkBegin + chunkSize : end;
+			group.numPending++;
+			push({[&function, &group, chunkBegin, chunkEnd]()
+			{
+				for (unsigned int i = chunkBegin; i < chunkEnd && !group.failed; i++)
+				{
+					function(i);
+				}
+			}, &group});
+		}
+		wait(group);
+	}
+
+	void TaskScheduler::run(Graph const & graph)
+	{
+		auto const & nodes = graph.nodes;
+		if (nodes.empty())
+		{
+			return;
+		}
+
+		// Check for cycles, since they would never finish.
+		std::vector<unsigned int> numDependencies(nodes.size());
+		std::vector<unsigned int> ready;
+		for (unsigned int i = 0; i < nodes.size(); i++)
+		{
+			numDependencies[i] = nodes[i].numDependencies;
+			if (numDependencies[i] == 0)
+			{
+				ready.push_back(i);
+			}
+		}
+		std::vector<unsigned int> roots = ready;
+		unsigned int numVisited = 0;
+		while (!ready.empty())
+		{
+			unsigned int i = ready.back();
+			ready.pop_back();
+			numVisited++;
+			for (auto dependent : nodes[i].dependents)
+			{
+				if (--numDependencies[dependent] == 0)
+				{
+					ready.push_back(dependent);
+				}
+			}
+		}
+		if (numVisited != nodes.size())
+		{
+			throw std::runtime_error("The task graph has a cycle. ");
+		}
+
+		std::unique_ptr<std::atomic<unsigned int>[]> numRemaining(new std::atomic<unsigned int>[nodes.size()]);
+		for (unsigned int i = 0; i < nodes.size(); i++)
+		{
+			numRemaining[i] = nodes[i].numDependencies;
+		}
+		Group group;
+		group.numPending = (unsigned int)nodes.size();
+		group.failed = false;
+
+		// Each task releases its dependents when done, even if it failed or was skipped, so that the group always finishes.
+		std::function<void(unsigned int)> launch = [&](unsigned int i)
+		{
+			Task task = {[&, i]()
+			{
+				try
+				{
+					if (!group.failed && nodes[i].function)
+					{
+						nodes[i].function();
+					}
+				}
+				catch (...)
+				{
+					setFailed(group, std::current_exception());
+				}
+				for (auto dependent : nodes[i].dependents)
+				{
+					if (numRemaining[dependent].fetch_sub(1) == 1)
+					{
+						launch(dependent);
+					}
+				}
+			}, &group};
+			if (nodes[i].callingThreadOnly)
+			{
+				std::lock_guard<std::mutex> lock(group.callingThreadMutex);
+				group.callingThreadTasks.push_back(std::move(task));
+			}
+			else
+			{
+				push(std::move(task));
+			}
+		};
+		for (auto root : roots)
+		{
+			launch(root);
+		}
+		wait(group);
+	}
+
+	void TaskScheduler::push(Task && task)
+	{
+		Queue & queue = queues[getCurrentQueueIndex()];
+		{
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			queue.tasks.push_back(std::move(task));
+		}
+		{
+			std::lock_guard<std::mutex> lock(sleepMutex);
+			numQueued++;
+		}
+		sleepCondition.notify_one();
+	}
+
+	bool TaskScheduler::pop(unsigned int queueIndex, Task & task)
+	{
+		// Take the newest task from our own queue, since it is most likely still in the cache.
+		{
+			Queue & queue = queues[queueIndex];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (!queue.tasks.empty())
+			{
+				task = std::move(queue.tasks.back());
+				queue.tasks.pop_back();
+				numQueued--;
+				return true;
+			}
+		}
+		// Otherwise steal the oldest task from another queue.
+		for (unsigned int i = 1; i < queues.size(); i++)
+		{
+			Queue & queue = queues[(queueIndex + i) % queues.size()];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (!queue.tasks.empty())
+			{
+				task = std::move(queue.tasks.front());
+				queue.tasks.pop_front();
+				numQueued--;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool TaskScheduler::popCallingThreadTask(Group & group, Task & task)
+	{
+		std::lock_guard<std::mutex> lock(group.callingThreadMutex);
+		if (group.callingThreadTasks.empty())
+		{
+			return false;
+		}
+		task = std::move(group.callingThreadTasks.front());
+		group.callingThreadTasks.pop_front();
+		return true;
+	}
+
+	void TaskScheduler::execute(Task & task)
+	{
+		Group & group = *task.group;
+		try
+		{
+			task.function();
+		}
+		catch (...)
+		{
+			setFailed(group, std::current_exception());
+		}
+		group.numPending--;
+	}
+
+	void TaskScheduler::setFailed(Group & group, std::exception_ptr exception)
+	{
+		std::lock_guard<std::mutex> lock(group.exceptionMutex);
+		if (!group.failed)
+		{
+			group.exception = exception;
+			group.failed = true;
+		}
+	}
+
+	void TaskScheduler::wait(Group & group)
+	{
+		unsigned int queueIndex = getCurrentQueueIndex();
+		while (group.numPending > 0)
+		{
+			Task task;
+			if (popCallingThreadTask(group, task) || pop(queueIndex, task))
+			{
+				execute(task);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+		if (group.exception)
+		{
+			std::rethrow_exception(group.exception);
+		}
+	}
+
+	void TaskScheduler::workerLoop(unsigned int queueIndex)
+	{
+		currentScheduler = this;
+		currentQueueIndex = queueIndex;
+		while (true)
+		{
+			Task task;
+			if (pop(queueIndex, task))
+			{
+				execute(task);
+				continue;
+			}
+			std::unique_lock<std::mutex> lock(sleepMutex);
+			sleepCondition.wait(lock, [this]()
+			{
+				return stopping || numQueued > 0;
+			});
+			if (stopping)
+			{
+				return;
+			}
+		}
+	}
+
+	unsigned int TaskScheduler::getCurrentQueueIndex() const
+	{
+		return (currentScheduler == this) ? currentQueueIndex : 0;
+	}
+
+	unsigned int TaskScheduler::Graph::addTask(std::function<void()> const & function, bool callingThreadOnly)
+	{
+		nodes.push_back(Node());
+		nodes.back().function = function;
+		nodes.back().callingThreadOnly = callingThreadOnly;
+		return (unsigned int)nodes.size() - 1;
+	}
+
+	void TaskScheduler::Graph::addDependency(unsigned int task, unsigned int dependency)
+	{
+		if (task >= nodes.size() || dependency >= nodes.size())
+		{
+			throw std::runtime_error("Invalid task id. ");
+		}
+		nodes[dependency].dependents.push_back(task);
+		nodes[task].numDependencies++;
+	}
+
+	unsigned int TaskScheduler::Graph::getNumTasks() const
+	{
+		return (unsigned int)nodes.size();
+	}
+
+	void TaskScheduler::Graph::clear()
+	{
+		nodes.clear();
+	}
+}
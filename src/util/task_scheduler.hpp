@@ -0,0 +1,110 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <exception>
+
+namespace ve
+{
+	//! A work-stealing thread pool. Each thread has its own queue of tasks and takes from other queues when its own is empty.
+	//! The thread that waits on a parallelFor or a graph runs tasks too, so a scheduler with one thread runs everything on the calling thread.
+	class TaskScheduler final
+	{
+	public:
+		//! A set of tasks with dependencies between them. It can be run many times.
+		class Graph;
+
+		//! Constructs the scheduler with numThreads threads in total, including the calling thread. If numThreads is 0, the number of hardware threads is used.
+		TaskScheduler(unsigned int numThreads);
+
+		//! Destructor. Waits for the worker threads to finish.
+		~TaskScheduler();
+
+		//! Returns the number of threads, including the calling thread.
+		unsigned int getNumThreads() const;
+
+		//! Calls function(i) for every i in [begin, end) and returns when they are all done. Indices are split into chunks of at least grainSize.
+		//! If any call throws, the remaining chunks are skipped and the first exception is rethrown here.
+		void parallelFor(unsigned int begin, unsigned int end, std::function<void(unsigned int index)> const & function, unsigned int grainSize = 1);
+
+		//! Runs the tasks of the graph, each after its dependencies, and returns when they are all done. Tasks added as calling-thread-only run on this thread.
+		//! If any task throws, the tasks not yet started are skipped and the first exception is rethrown here.
+		void run(Graph const & graph);
+
+	private:
+		struct Group;
+
+		struct Task
+		{
+			std::function<void()> function;
+			Group * group;
+		};
+
+		// Tracks a group of tasks so that a thread can wait on them.
+		struct Group
+		{
+			std::atomic<unsigned int> numPending;
+			std::atomic<bool> failed;
+			std::exception_ptr exception;
+			std::mutex exceptionMutex;
+			std::deque<Task> callingThreadTasks; // Tasks that only the waiting thread may run.
+			std::mutex callingThreadMutex;
+		};
+
+		struct Queue
+		{
+			std::deque<Task> tasks;
+			std::mutex mutex;
+		};
+
+		void push(Task && task);
+		bool pop(unsigned int queueIndex, Task & task);
+		bool popCallingThreadTask(Group & group, Task & task);
+		void execute(Task & task);
+		static void setFailed(Group & group, std::exception_ptr exception);
+		void wait(Group & group);
+		void workerLoop(unsigned int queueIndex);
+		unsigned int getCurrentQueueIndex() const;
+
+		std::vector<Queue> queues; // Queue 0 belongs to the threads that are not workers.
+		std::vector<std::thread> workers;
+		std::atomic<int> numQueued;
+		std::atomic<bool> stopping;
+		std::mutex sleepMutex;
+		std::condition_variable sleepCondition;
+	};
+
+	class TaskScheduler::Graph
+	{
+	public:
+		//! Adds a task and returns its id. If callingThreadOnly is true, the task only runs on the thread that runs the graph, such as for work that uses the GL context.
+		unsigned int addTask(std::function<void()> const & function, bool callingThreadOnly = false);
+
+		//! Makes the task wait until the dependency has finished.
+		void addDependency(unsigned int task, unsigned int dependency);
+
+		//! Returns the number of tasks.
+		unsigned int getNumTasks() const;
+
+		//! Removes all tasks.
+		void clear();
+
+	private:
+		struct Node
+		{
+			std::function<void()> function;
+			std::vector<unsigned int> dependents;
+			unsigned int numDependencies = 0;
+			bool callingThreadOnly = false;
+		};
+
+		std::vector<Node> nodes;
+
+		friend class TaskScheduler;
+	};
+}
@@ -0,0 +1,62 @@
+#include "update_schedule.hpp"
+#include <cmath>
+#include <stdexcept>
+
+namespace ve
+{
+	unsigned int UpdateSchedule::getDivisor(float secondsPerStep) const
+	{
+		if (rate == 0)
+		{
+			return divisor;
+		}
+		float steps = std::round(1.0f / (rate * secondsPerStep));
+		return steps < 1.0f ? 1 : (unsigned int)steps;
+	}
+
+	void UpdateSchedule::setDivisor(unsigned int divisor_)
+	{
+		if (divisor_ == 0)
+		{
+			throw std::runtime_error("The update divisor must be at least 1. ");
+		}
+		divisor = divisor_;
+		rate = 0;
+	}
+
+	void UpdateSchedule::setRate(float updatesPerSecond)
+	{
+		if (!(updatesPerSecond > 0))
+		{
+			throw std::runtime_error("The update rate must be more than 0. ");
+		}
+		rate = updatesPerSecond;
+	}
+
+	bool UpdateSchedule::advance(unsigned int step, float secondsPerStep, std::map<unsigned int, unsigned int> & nextPhases)
+	{
+		unsigned int newDivisor = getDivisor(secondsPerStep);
+		if (newDivisor != currentDivisor)
+		{
+			currentDivisor = newDivisor;
+			phase = nextPhases[currentDivisor]++ % currentDivisor;
+		}
+		if ((step + phase) % currentDivisor == 0)
+		{
+			stepsSinceUpdate = 0;
+			return true;
+		}
+		stepsSinceUpdate++;
+		return false;
+	}
+
+	unsigned int UpdateSchedule::getCurrentDivisor() const
+	{
+		return currentDivisor;
+	}
+
+	unsigned int UpdateSchedule::getStepsSinceUpdate() const
+	{
+		return stepsSinceUpdate;
+	}
+}
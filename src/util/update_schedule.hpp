@@ -0,0 +1,38 @@
+#pragma once
+
+#include <map>
+
+namespace ve
+{
+	// When something updates on a fixed step, as a number of steps per update, so that it can update less often than every step.
+	// Schedules with the same number of steps per update are given different phases, so that their updates are spread across the steps instead of all landing on the same one.
+	class UpdateSchedule final
+	{
+	public:
+		// Returns the number of steps per update, given the seconds per step. It is 1 unless set otherwise.
+		unsigned int getDivisor(float secondsPerStep) const;
+
+		// Sets the number of steps per update. It must be at least 1.
+		void setDivisor(unsigned int divisor);
+
+		// Sets the number of steps per update from the updates per second, rounded to the nearest whole number of steps. It must be more than 0.
+		void setRate(float updatesPerSecond);
+
+		// Advances to the step. Returns true if it updates on this step, which is every divisor steps.
+		// When the divisor changes, the schedule takes the next phase from nextPhases for its divisor, so schedules sharing nextPhases take turns.
+		bool advance(unsigned int step, float secondsPerStep, std::map<unsigned int, unsigned int> & nextPhases);
+
+		// Returns the number of steps per update as of the last advance, or 0 if it hasn't advanced.
+		unsigned int getCurrentDivisor() const;
+
+		// Returns the number of steps advanced since the last update, 0 if it updated on the last step.
+		unsigned int getStepsSinceUpdate() const;
+
+	private:
+		unsigned int divisor = 1;
+		float rate = 0; // If not 0, the divisor is calculated from it.
+		unsigned int currentDivisor = 0;
+		unsigned int phase = 0;
+		unsigned int stepsSinceUpdate = 0;
+	};
+}
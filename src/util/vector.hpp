@@ -2,26 +2,34 @@
 
 #include <initializer_list>
 #include <exception>
+#include <type_traits>
 #include <cmath>
 
 namespace ve
 {
+	// A tag for constructing the math types without initializing their elements, such as for large buffers that will be filled right after.
+	struct Uninitialized {};
+	constexpr Uninitialized uninitialized {};
+
 	// This is a standard mathematical vector class. Dim is the dimensions of the vector and T is the type of its elements.
 	template <unsigned int dim, typename T>
 	class Vector final
 	{
 	public:
 		// Default constructor. Zeroes all elements.
-		Vector();
+		constexpr Vector();
+
+		// Constructor that leaves the elements uninitialized.
+		explicit Vector(Uninitialized);
 
 		// Copy constructor.
-		Vector(Vector<dim, T> const & v);
+		Vector(Vector<dim, T> const & v) = default;
 
 		// Initializer list constructor.
 		Vector(std::initializer_list<T> const & a);
 
 		// Assignment operator.
-		Vector<dim, T> const & operator = (Vector<dim, T> const & v);
+		Vector<dim, T> & operator = (Vector<dim, T> const & v) = default;
 
 		// Set the elements from an initializer list.
 		Vector<dim, T> const & operator = (std::initializer_list<T> const & a);
@@ -129,6 +137,10 @@ namespace ve
 	typedef Vector<3, double> Vector3d;
 	typedef Vector<4, double> Vector4d;
 
+	// The vectors are laid out as plain arrays so that they can be copied as bytes, passed to GL, and serialized in blocks.
+	static_assert(sizeof(Vector3f) == 3 * sizeof(float) && sizeof(Vector4d) == 4 * sizeof(double), "Vector is not tightly packed.");
+	static_assert(std::is_trivially_copyable<Vector3f>::value && std::is_trivially_copyable<Vector2i>::value, "Vector is not trivially copyable.");
+
 	// Returns true if each element in v0 is equal to the corresponding element in v1.
 	template <unsigned int dim, typename T> bool operator == (Vector<dim, T> v0, Vector<dim, T> v1);
 
@@ -162,20 +174,16 @@ namespace ve
 	// Template implementations
 
 	template <unsigned int dim, typename T>
-	Vector<dim, T>::Vector()
+	constexpr Vector<dim, T>::Vector()
+		: c()
 	{
 		static_assert(dim > 0, "dim == 0");
-		for (unsigned int i = 0; i < dim; ++i)
-		{
-			c[i] = 0;
-		}
 	}
 
 	template <unsigned int dim, typename T>
-	Vector<dim, T>::Vector(Vector<dim, T> const & a)
+	Vector<dim, T>::Vector(Uninitialized)
 	{
 		static_assert(dim > 0, "dim == 0");
-		*this = a;
 	}
 
 	template <unsigned int dim, typename T>
@@ -185,16 +193,6 @@ namespace ve
 		*this = a;
 	}
 
-	template <unsigned int dim, typename T>
-	Vector<dim, T> const & Vector<dim, T>::operator = (Vector<dim, T> const & v)
-	{
-		for (unsigned int i = 0; i < dim; ++i)
-		{
-			c[i] = v.c[i];
-		}
-		return *this;
-	}
-
 	template <unsigned int dim, typename T>
 	Vector<dim, T> const & Vector<dim, T>::operator = (std::initializer_list<T> const & a)
 	{
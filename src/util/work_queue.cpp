@@ -0,0 +1,141 @@
+#include "work_queue.hpp"
+#include "profiler.hpp"
+#include <chrono>
+#include <string>
+
+namespace ve
+{
+	WorkQueue::WorkQueue(float budget_)
+	{
+		budget = budget_;
+	}
+
+	float WorkQueue::getBudget() const
+	{
+		return budget;
+	}
+
+	void WorkQueue::setBudget(float budget_)
+	{
+		budget = budget_;
+	}
+
+	unsigned int WorkQueue::submit(Job const & job)
+	{
+		unsigned int id = nextId++;
+		if (nextId == 0)
+		{
+			nextId = 1; // 0 is never an id.
+		}
+		jobs.push_back({id, job});
+		return id;
+	}
+
+	void WorkQueue::cancel(unsigned int id)
+	{
+		if (id == runningId)
+		{
+			runningCanceled = true;
+			return;
+		}
+		for (auto it = jobs.begin(); it != jobs.end(); it++)
+		{
+			if (it->id == id)
+			{
+				jobs.erase(it);
+				return;
+			}
+		}
+	}
+
+	void WorkQueue::finish(unsigned int id)
+	{
+		if (id == runningId)
+		{
+			return;
+		}
+		for (auto it = jobs.begin(); it != jobs.end(); it++)
+		{
+			if (it->id == id)
+			{
+				// Move it to the front and run it there.
+				Entry entry = std::move(*it);
+				jobs.erase(it);
+				jobs.push_front(std::move(entry));
+				while (!jobs.empty() && jobs.front().id == id)
+				{
+					runSlice();
+				}
+				return;
+			}
+		}
+	}
+
+	bool WorkQueue::isQueued(unsigned int id) const
+	{
+		if (id == runningId)
+		{
+			return !runningCanceled;
+		}
+		for (auto && entry : jobs)
+		{
+			if (entry.id == id)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	unsigned int WorkQueue::getNumJobs() const
+	{
+		return (unsigned int)jobs.size();
+	}
+
+	void WorkQueue::run()
+	{
+		if (jobs.empty())
+		{
+			return;
+		}
+		auto startTime = std::chrono::steady_clock::now();
+		float seconds = 0;
+		do
+		{
+			runSlice();
+			seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
+		} while (!jobs.empty() && seconds < budget);
+		if (Profiler::isInitialized())
+		{
+			Profiler::addSample("work queue, budget " + std::to_string(budget), seconds);
+			if (seconds > budget)
+			{
+				Profiler::addSample("work queue overrun", seconds - budget);
+			}
+		}
+	}
+
+	void WorkQueue::runSlice()
+	{
+		// The job is taken out while it runs, since it may submit or cancel other jobs.
+		Entry entry = std::move(jobs.front());
+		jobs.pop_front();
+		runningId = entry.id;
+		runningCanceled = false;
+		bool done;
+		try
+		{
+			done = entry.job();
+		}
+		catch (...)
+		{
+			runningId = 0;
+			throw;
+		}
+		runningId = 0;
+		if (!done && !runningCanceled)
+		{
+			jobs.push_front(std::move(entry));
+		}
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <functional>
+#include <deque>
+
+namespace ve
+{
+	//! A queue of jobs that are run a slice at a time on the main thread, until a time budget for the frame is used up, so that expensive work is spread over frames instead of causing a hitch.
+	//! Anything with a queued job must cancel it when it is destroyed.
+	class WorkQueue final
+	{
+	public:
+		//! A job does a slice of its work each time it is called. It returns true when it is done, or false to be called again later.
+		typedef std::function<bool()> Job;
+
+		//! Constructs the queue with a budget in seconds per frame.
+		WorkQueue(float budget);
+
+		//! Returns the budget in seconds per frame.
+		float getBudget() const;
+
+		//! Sets the budget in seconds per frame.
+		void setBudget(float budget);
+
+		//! Adds a job to the end of the queue. Returns an id to cancel or finish it with.
+		unsigned int submit(Job const & job);
+
+		//! Removes the job if it is queued. It may be called by the job itself.
+		void cancel(unsigned int id);
+
+		//! Runs the job until it is done, whatever the budget, such as when its result is needed right away. Does nothing if it isn't queued.
+		void finish(unsigned int id);
+
+		//! Returns true if the job is still queued.
+		bool isQueued(unsigned int id) const;
+
+		//! Returns the number of jobs queued.
+		unsigned int getNumJobs() const;
+
+		//! Runs slices of the jobs in order until the budget is used up. At least one slice is run, so the queue always makes progress, even if the slice overruns the budget.
+		//! The time used and any overrun are written to the profiler. Called by App once per frame.
+		void run();
+
+	private:
+		struct Entry
+		{
+			unsigned int id;
+			Job job;
+		};
+
+		// Runs a slice of the job at the front, and then puts it back at the front if it isn't done.
+		void runSlice();
+
+		std::deque<Entry> jobs;
+		float budget;
+		unsigned int nextId = 1;
+		unsigned int runningId = 0; // The job running a slice, if any.
+		bool runningCanceled = false; // True if the running job was canceled during its slice.
+	};
+}
@@ -1,5 +1,7 @@
 #include "window.hpp"
+#include "render/open_gl.hpp"
 #include <SDL.h>
+#include <algorithm>
 #include <stdexcept>
 
 namespace ve
@@ -8,10 +10,17 @@ namespace ve
 	{
 		// Initialize SDL.
 		Vector2i initialSize {800, 600};
-		sdlWindow = SDL_CreateWindow("Untitled", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, initialSize[0], initialSize[1], SDL_WINDOW_RESIZABLE | SDL_WINDOW_OPENGL);
-		if (sdlWindow == nullptr)
+		if (render::glIsNullBackend()) // The null backend has no display, so the window is headless.
 		{
-			throw std::runtime_error("Failed to create the window.");
+			sdlWindow = nullptr;
+		}
+		else
+		{
+			sdlWindow = SDL_CreateWindow("Untitled", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, initialSize[0], initialSize[1], SDL_WINDOW_RESIZABLE | SDL_WINDOW_OPENGL);
+			if (sdlWindow == nullptr)
+			{
+				throw std::runtime_error("Failed to create the window.");
+			}
 		}
 
 		// Create a new window target.
@@ -27,7 +36,10 @@ namespace ve
 	{
 		gui.setNull();
 		target.setNull();
-		SDL_DestroyWindow((SDL_Window *)sdlWindow);
+		if (sdlWindow != nullptr)
+		{
+			SDL_DestroyWindow((SDL_Window *)sdlWindow);
+		}
 	}
 
 	Ptr<Gui> Window::getGui() const
@@ -56,6 +68,41 @@ namespace ve
 	void Window::onResized(Vector2i size)
 	{
 		gui->setSize(size);
+		target->markChanged();
+	}
+
+	void Window::onVisibilityChanged(bool visible_)
+	{
+		if (visible_ && !visible)
+		{
+			target->markChanged(); // Changes weren't rendered while it was hidden.
+		}
+		visible = visible_;
+	}
+
+	void Window::onExposed()
+	{
+		target->markChanged();
+	}
+
+	bool Window::isVisible() const
+	{
+		return visible;
+	}
+
+	void Window::markChanged()
+	{
+		target->markChanged();
+	}
+
+	void Window::requestFrames(float seconds)
+	{
+		secondsOfFramesRequested = std::max(secondsOfFramesRequested, seconds);
+	}
+
+	bool Window::needsRender() const
+	{
+		return secondsOfFramesRequested > 0 || target->needsRender();
 	}
 
 	void Window::onCursorPositionChanged(std::optional<Vector2i> cursorPosition_)
@@ -67,6 +114,7 @@ namespace ve
 	void Window::update(float dt)
 	{
 		gui->update(dt);
+		secondsOfFramesRequested = std::max(secondsOfFramesRequested - dt, 0.f);
 	}
 
 	void Window::preRender()
@@ -74,8 +122,18 @@ namespace ve
 		target->clearRenderedThisFrameFlag();
 	}
 
-	void Window::render() const
+	void Window::render(TaskScheduler & taskScheduler) const
+	{
+		target->render(taskScheduler);
+	}
+
+	void Window::record(TaskScheduler & taskScheduler) const
+	{
+		target->record(taskScheduler);
+	}
+
+	void Window::replay() const
 	{
-		target->render();
+		target->replay();
 	}
 }
\ No newline at end of file
@@ -32,6 +32,24 @@ namespace ve
 		// Called by App when the user resizes the window.
 		void onResized(Vector2i size);
 
+		// Called by App when the window is minimized or hidden, or is shown again. A window that isn't visible isn't rendered.
+		void onVisibilityChanged(bool visible);
+
+		// Called by App when part of the window was uncovered, so that it is drawn again.
+		void onExposed();
+
+		// Returns true if the window isn't minimized or hidden.
+		bool isVisible() const;
+
+		// Marks the window as changed, so that it renders on the next frame when the app renders on demand.
+		void markChanged();
+
+		// Renders the window on every frame for the next seconds, even if nothing has been marked changed, such as for an animation. Only needed when the app renders on demand.
+		void requestFrames(float seconds);
+
+		// Returns true if the window needs to render: its gui or a target it depends on has changed, or frames have been requested.
+		bool needsRender() const;
+
 		// Called by App when the user moves the cursor within the window or out of the window.
 		void onCursorPositionChanged(std::optional<Vector2i> cursorPosition);
 
@@ -41,8 +59,14 @@ namespace ve
 		// Called by App to prepare the window for rendering.
 		void preRender();
 
-		// Called by App to render the window.
-		void render() const;
+		// Called by App to render the window. The scenes are recorded in parallel on the task scheduler.
+		void render(TaskScheduler & taskScheduler) const;
+
+		// Called by App to record the window's rendering without touching GL, when frames are pipelined.
+		void record(TaskScheduler & taskScheduler) const;
+
+		// Called by App to make the GL calls of the last record, when frames are pipelined.
+		void replay() const;
 
 	private:
 		void * sdlWindow;
@@ -50,5 +74,7 @@ namespace ve
 		OwnPtr<render::WindowTarget> target;
 		std::optional<Vector2i> cursorPosition;
 		OwnPtr<Gui> gui;
+		bool visible = true;
+		float secondsOfFramesRequested = 0;
 	};
 }
\ No newline at end of file
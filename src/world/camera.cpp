@@ -5,6 +5,14 @@ namespace ve
 {
 	namespace world
 	{
+		// The std140 layout of the uniform block
+		//   layout(std140) uniform Camera { mat4 worldToCameraTramsform; mat4 cameraToNdcTransform; };
+		struct CameraUniforms
+		{
+			Matrix44f worldToCameraTramsform;
+			Matrix44f cameraToNdcTransform;
+		};
+
 		Camera::Camera()
 		{
 			aspectRatio = 1.0f;
@@ -21,7 +29,8 @@ namespace ve
 			ndcToLocalTransform(1, 1) = 0;
 			ndcToLocalTransform(1, 3) = 1;
 			ndcToLocalTransform(2, 2) = 0;
-			transformsNeedUpdate = true;
+			uniformBuffer.setNew("Camera");
+			updateProjection();
 		}
 
 		Camera:: ~Camera()
@@ -37,7 +46,7 @@ namespace ve
 		void Camera::setAspectRatio(float aspectRatio_)
 		{
 			aspectRatio = aspectRatio_;
-			transformsNeedUpdate = true;
+			updateProjection();
 		}
 
 		float Camera::getNear() const
@@ -48,7 +57,7 @@ namespace ve
 		void Camera::setNear(float near_)
 		{
 			near = near_;
-			transformsNeedUpdate = true;
+			updateProjection();
 		}
 
 		float Camera::getFar() const
@@ -59,7 +68,7 @@ namespace ve
 		void Camera::setFar(float far_)
 		{
 			far = far_;
-			transformsNeedUpdate = true;
+			updateProjection();
 		}
 
 		float Camera::getFov() const
@@ -71,7 +80,7 @@ namespace ve
 		{
 			fov = fov_;
 			perspective = true;
-			transformsNeedUpdate = true;
+			updateProjection();
 		}
 
 		float Camera::getSize() const
@@ -83,88 +92,109 @@ namespace ve
 		{
 			size = size_;
 			perspective = false;
-			transformsNeedUpdate = true;
+			updateProjection();
 		}
 
 		Vector2f Camera::getNdcPosition(Vector3f worldPosition) const
 		{
-			checkTransforms();
 			Vector3f localPosition = getWorldToLocalTransform().transform(worldPosition, 1);
 			return localToNdcTransform.transform(localPosition, 1).shrink<2>();
 		}
 
+		void Camera::getNdcPositions(Vector3f const * worldPositions, Vector2f * ndcPositions, unsigned int count) const
+		{
+			Matrix44f worldToNdcTransform = localToNdcTransform * getWorldToLocalTransform();
+			Vector3f buffer[64];
+			for (unsigned int n = 0; n < count; n += 64)
+			{
+				unsigned int bufferCount = (count - n < 64) ? count - n : 64;
+				worldToNdcTransform.transform(worldPositions + n, buffer, bufferCount, 1);
+				for (unsigned int i = 0; i < bufferCount; i++)
+				{
+					ndcPositions[n + i] = buffer[i].shrink<2>();
+				}
+			}
+		}
+
 		Ray3f Camera::getRay(Vector2f ndcPosition) const
 		{
-			checkTransforms();
 			Vector3f localPosition = ndcToLocalTransform.transform(Vector3f({ndcPosition[0], +1.f, ndcPosition[1]}), 1);
-			return Ray3f(getPosition(), getLocalToWorldTransform().transform(localPosition, 1));
+			return Ray3f(getWorldPosition(), getLocalToWorldTransform().transform(localPosition, 0));
 		}
 
 		Matrix44f const & Camera::getLocalToNdcTransform() const
 		{
-			checkTransforms();
 			return localToNdcTransform;
 		}
 
 		Matrix44f const & Camera::getNdcToLocalTransform() const
 		{
-			checkTransforms();
 			return ndcToLocalTransform;
 		}
 
-		void Camera::checkTransforms() const
+		Ptr<render::UniformBuffer> Camera::getUniformBuffer() const
 		{
-			if (transformsNeedUpdate)
+			return uniformBuffer;
+		}
+
+		void Camera::updateUniformBuffer()
+		{
+			CameraUniforms uniforms;
+			uniforms.worldToCameraTramsform = getRenderWorldToLocalTransform();
+			uniforms.cameraToNdcTransform = localToNdcTransform;
+			uniformBuffer->setData(uniforms);
+		}
+
+		void Camera::updateProjection()
+		{
+			// The projection is computed here rather than lazily in the getters so that they can be called from several threads.
+			float scale;
+			if (perspective)
 			{
-				float scale;
-				if (perspective)
-				{
-					scale = std::tan(fov / 2.0f);
-				}
-				else
-				{
-					scale = size;
-				}
-				if (scale == 0 || aspectRatio == 0 || far == near || near == 0 || far == 0)
-				{
-					return;
-				}
-				float scaleInv = 1.0f / scale;
-				if (aspectRatio >= 1)
-				{
-					localToNdcTransform(0, 0) = scaleInv / aspectRatio;
-					localToNdcTransform(1, 2) = scaleInv;
-					ndcToLocalTransform(0, 0) = scale * aspectRatio;
-					ndcToLocalTransform(2, 1) = scale;
-				}
-				else
-				{
-					localToNdcTransform(0, 0) = scaleInv;
-					localToNdcTransform(1, 2) = scaleInv * aspectRatio;
-					ndcToLocalTransform(0, 0) = scale;
-					ndcToLocalTransform(2, 1) = scale / aspectRatio;
-				}
-				if (perspective)
-				{
-					float nf2 = 2 * near * far;
-					float nmf = near - far;
-					float npf = near + far;
-					localToNdcTransform(2, 1) = -npf / nmf;
-					localToNdcTransform(2, 3) = nf2 / nmf;
-					ndcToLocalTransform(3, 2) = nmf / nf2;
-					ndcToLocalTransform(3, 3) = npf / nf2;
-				}
-				else
-				{
-					// TODO, NEEDS FIXING
-					float nmf = near - far;
-					float npf = near + far;
-					localToNdcTransform(2, 1) = 2 / nmf;
-					localToNdcTransform(2, 3) = -npf / nmf;
-					ndcToLocalTransform(1, 2) = nmf / 2;
-					ndcToLocalTransform(2, 3) = npf / 2;
-				}
-				transformsNeedUpdate = false;
+				scale = std::tan(fov / 2.0f);
+			}
+			else
+			{
+				scale = size;
+			}
+			if (scale == 0 || aspectRatio == 0 || far == near || near == 0 || far == 0)
+			{
+				return;
+			}
+			float scaleInv = 1.0f / scale;
+			if (aspectRatio >= 1)
+			{
+				localToNdcTransform(0, 0) = scaleInv / aspectRatio;
+				localToNdcTransform(1, 2) = scaleInv;
+				ndcToLocalTransform(0, 0) = scale * aspectRatio;
+				ndcToLocalTransform(2, 1) = scale;
+			}
+			else
+			{
+				localToNdcTransform(0, 0) = scaleInv;
+				localToNdcTransform(1, 2) = scaleInv * aspectRatio;
+				ndcToLocalTransform(0, 0) = scale;
+				ndcToLocalTransform(2, 1) = scale / aspectRatio;
+			}
+			if (perspective)
+			{
+				float nf2 = 2 * near * far;
+				float nmf = near - far;
+				float npf = near + far;
+				localToNdcTransform(2, 1) = -npf / nmf;
+				localToNdcTransform(2, 3) = nf2 / nmf;
+				ndcToLocalTransform(3, 2) = nmf / nf2;
+				ndcToLocalTransform(3, 3) = npf / nf2;
+			}
+			else
+			{
+				// TODO, NEEDS FIXING
+				float nmf = near - far;
+				float npf = near + far;
+				localToNdcTransform(2, 1) = 2 / nmf;
+				localToNdcTransform(2, 3) = -npf / nmf;
+				ndcToLocalTransform(1, 2) = nmf / 2;
+				ndcToLocalTransform(2, 3) = npf / 2;
 			}
 		}
 	}
@@ -50,7 +50,10 @@ namespace ve
 			// Returns the normalized device coordinates of a given position in world coordinates.
 			Vector2f getNdcPosition(Vector3f worldPosition) const;
 
-			// Returns a ray in world coordinates of the given position in normalized device coordinates.
+			// Sets ndcPositions[n] to the normalized device coordinates of worldPositions[n] for count positions.
+			void getNdcPositions(Vector3f const * worldPositions, Vector2f * ndcPositions, unsigned int count) const;
+
+			// Returns a ray in world coordinates of the given position in normalized device coordinates. It starts at the camera and its offset is the direction through the position.
 			Ray3f getRay(Vector2f ndcPosition) const;
 
 			// Returns the local to normalized device coordinates transform matrix.
@@ -59,8 +62,14 @@ namespace ve
 			// Returns the normalized device coordinates to local transform matrix.
 			Matrix44f const & getNdcToLocalTransform() const;
 
+			// Returns the uniform buffer for the Camera block, which targets rendering from this camera bind. Internal to world.
+			Ptr<render::UniformBuffer> getUniformBuffer() const;
+
+			// Updates the uniform buffer from the render transforms. Internal to world.
+			void updateUniformBuffer();
+
 		private:
-			void checkTransforms() const;
+			void updateProjection();
 
 			float aspectRatio;
 			float near;
@@ -68,9 +77,9 @@ namespace ve
 			float fov;
 			float size;
 			bool perspective;
-			mutable bool transformsNeedUpdate;
-			mutable Matrix44f localToNdcTransform;
-			mutable Matrix44f ndcToLocalTransform;
+			Matrix44f localToNdcTransform;
+			Matrix44f ndcToLocalTransform;
+			OwnPtr<render::UniformBuffer> uniformBuffer;
 		};
 	}
 }
@@ -0,0 +1,12 @@
+#include "world/controller.hpp"
+
+namespace ve
+{
+	namespace world
+	{
+		UpdateSchedule & Controller::getUpdateSchedule()
+		{
+			return updateSchedule;
+		}
+	}
+}
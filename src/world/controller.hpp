@@ -1,6 +1,7 @@
 #pragma once
 
 #include "input_event.hpp"
+#include "util/update_schedule.hpp"
 
 namespace ve
 {
@@ -9,9 +10,18 @@ namespace ve
 		class Controller
 		{
 		public:
+			// Called by the world on the GL thread, unless the world's update is concurrent. Then it is on a worker thread while other worlds update, so only touch this world and don't create objects or cameras.
+			// If the controller updates every few world updates, dt is the time since its last update.
 			virtual void update(float dt) = 0;
 
 			virtual void handleInputEvent(InputEvent const & inputEvent) = 0;
+
+			// Returns the schedule of the controller's updates. By default it updates on every world update.
+			// Set a divisor or a rate for controllers that need fewer updates, such as AI. The world spreads those with the same divisor across its updates.
+			UpdateSchedule & getUpdateSchedule();
+
+		private:
+			UpdateSchedule updateSchedule;
 		};
 	}
-}
\ No newline at end of file
+}
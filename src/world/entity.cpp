@@ -1,4 +1,8 @@
 #include "world/entity.hpp"
+#include "world/transform_store.hpp"
+#include "world/world.hpp"
+#include <algorithm>
+#include <stdexcept>
 
 namespace ve
 {
@@ -6,78 +10,324 @@ namespace ve
 	{
 		Entity::Entity()
 		{
+			world = nullptr;
+			transformStore = nullptr;
+			transformIndex = 0;
 			worldToLocalTransform = localToWorldTransform = Matrix44f::identity();
-			transformsNeedUpdate = false;
+			transformsDirty = false;
+			dirtyRootsIndex = notListed;
+			movingEntitiesIndex = notListed;
+			previousTransformsValid = false;
+			renderTransformsInterpolated = false;
 		}
 
 		Entity::~Entity()
 		{
+			if (world != nullptr)
+			{
+				world->onEntityDestroyed(this);
+			}
+			if (transformStore != nullptr)
+			{
+				transformStore->remove(this);
+			}
+			for (auto child : children)
+			{
+				child->parent.setNull();
+				child->markHierarchyChanged();
+				child->markTransformsDirty();
+			}
+			if (parent.isValid())
+			{
+				auto & siblings = parent->children;
+				siblings.erase(std::find(siblings.begin(), siblings.end(), this));
+			}
+		}
+
+		Ptr<Entity> Entity::getParent() const
+		{
+			return parent;
+		}
+
+		void Entity::setParent(Ptr<Entity> const & parent_)
+		{
+			if (parent_.raw() == parent.raw())
+			{
+				return;
+			}
+			for (Entity * ancestor = parent_.raw(); ancestor != nullptr; ancestor = ancestor->parent.raw())
+			{
+				if (ancestor == this)
+				{
+					throw std::runtime_error("An entity cannot be its own ancestor. ");
+				}
+			}
+			if (parent.isValid())
+			{
+				auto & siblings = parent->children;
+				siblings.erase(std::find(siblings.begin(), siblings.end(), this));
+			}
+			parent = parent_;
+			if (parent.isValid())
+			{
+				parent->children.push_back(this);
+			}
+			markHierarchyChanged();
+			markTransformsDirty();
+		}
+
+		std::vector<Entity *> const & Entity::getChildren() const
+		{
+			return children;
 		}
 
 		Vector3f const & Entity::getPosition() const
 		{
+			if (transformStore != nullptr)
+			{
+				return transformStore->positions[transformIndex];
+			}
 			return position;
 		}
 
 		void Entity::setPosition(Vector3f const & position_)
 		{
-			position = position_;
-			transformsNeedUpdate = true;
+			if (transformStore != nullptr)
+			{
+				transformStore->positions[transformIndex] = position_;
+			}
+			else
+			{
+				position = position_;
+			}
+			markMoving();
+			markTransformsDirty();
 		}
 
 		Quaternionf const & Entity::getOrientation() const
 		{
+			if (transformStore != nullptr)
+			{
+				return transformStore->orientations[transformIndex];
+			}
 			return orientation;
 		}
 
 		void Entity::setOrientation(Quaternionf const & orientation_)
 		{
-			orientation = orientation_;
-			transformsNeedUpdate = true;
+			if (transformStore != nullptr)
+			{
+				transformStore->orientations[transformIndex] = orientation_;
+			}
+			else
+			{
+				orientation = orientation_;
+			}
+			markMoving();
+			markTransformsDirty();
+		}
+
+		Vector3f Entity::getWorldPosition() const
+		{
+			Matrix44f const & transform = getLocalToWorldTransform();
+			return {transform(0, 3), transform(1, 3), transform(2, 3)};
 		}
 
 		Matrix44f const & Entity::getLocalToWorldTransform() const
 		{
-			checkTransforms();
+			if (transformStore != nullptr)
+			{
+				return transformStore->localToWorldTransforms[transformIndex];
+			}
 			return localToWorldTransform;
 		}
 
 		Matrix44f const & Entity::getWorldToLocalTransform() const
 		{
-			checkTransforms();
+			if (transformStore != nullptr)
+			{
+				return transformStore->worldToLocalTransforms[transformIndex];
+			}
 			return worldToLocalTransform;
 		}
 
-		void Entity::checkTransforms() const
-		{
-			if (transformsNeedUpdate)
-			{
-				Matrix33f rot = orientation.getMatrix();
-				localToWorldTransform(0, 0) = rot(0, 0);
-				localToWorldTransform(1, 0) = rot(1, 0);
-				localToWorldTransform(2, 0) = rot(2, 0);
-				localToWorldTransform(0, 1) = rot(0, 1);
-				localToWorldTransform(1, 1) = rot(1, 1);
-				localToWorldTransform(2, 1) = rot(2, 1);
-				localToWorldTransform(0, 2) = rot(0, 2);
-				localToWorldTransform(1, 2) = rot(1, 2);
-				localToWorldTransform(2, 2) = rot(2, 2);
-				localToWorldTransform(0, 3) = position[0];
-				localToWorldTransform(1, 3) = position[1];
-				localToWorldTransform(2, 3) = position[2];
-				worldToLocalTransform(0, 0) = rot(0, 0);
-				worldToLocalTransform(1, 0) = rot(0, 1);
-				worldToLocalTransform(2, 0) = rot(0, 2);
-				worldToLocalTransform(0, 1) = rot(1, 0);
-				worldToLocalTransform(1, 1) = rot(1, 1);
-				worldToLocalTransform(2, 1) = rot(1, 2);
-				worldToLocalTransform(0, 2) = rot(2, 0);
-				worldToLocalTransform(1, 2) = rot(2, 1);
-				worldToLocalTransform(2, 2) = rot(2, 2);
-				worldToLocalTransform(0, 3) = (-position[0] * rot(0, 0) - position[1] * rot(1, 0) - position[2] * rot(2, 0));
-				worldToLocalTransform(1, 3) = (-position[0] * rot(0, 1) - position[1] * rot(1, 1) - position[2] * rot(2, 1));
-				worldToLocalTransform(2, 3) = (-position[0] * rot(0, 2) - position[1] * rot(1, 2) - position[2] * rot(2, 2));
-				transformsNeedUpdate = false;
+		Matrix44f const & Entity::getRenderLocalToWorldTransform() const
+		{
+			return renderTransformsInterpolated ? renderLocalToWorldTransform : getLocalToWorldTransform();
+		}
+
+		Matrix44f const & Entity::getRenderWorldToLocalTransform() const
+		{
+			return renderTransformsInterpolated ? renderWorldToLocalTransform : getWorldToLocalTransform();
+		}
+
+		bool Entity::transformsNeedUpdate() const
+		{
+			if (transformStore != nullptr)
+			{
+				return transformStore->dirty[transformIndex] != 0;
+			}
+			return transformsDirty;
+		}
+
+		void Entity::updateTransforms()
+		{
+			if (transformStore != nullptr || !transformsDirty)
+			{
+				return;
+			}
+			calculateTransforms(position, orientation, parent.raw(), localToWorldTransform, worldToLocalTransform);
+			transformsDirty = false;
+		}
+
+		void Entity::savePreviousTransforms()
+		{
+			previousPosition = getPosition();
+			previousOrientation = getOrientation();
+			previousTransformsValid = true;
+		}
+
+		void Entity::updateRenderTransforms(float alpha)
+		{
+			Vector3f const & currentPosition = getPosition();
+			Quaternionf const & currentOrientation = getOrientation();
+			bool moving = previousTransformsValid && (previousPosition != currentPosition
+				|| previousOrientation.r != currentOrientation.r || previousOrientation.ijk != currentOrientation.ijk);
+			Entity const * parentEntity = parent.raw();
+			if (moving || (parentEntity != nullptr && parentEntity->renderTransformsInterpolated))
+			{
+				Vector3f position = moving ? previousPosition + (currentPosition - previousPosition) * alpha : currentPosition;
+				Quaternionf orientation = moving ? nlerp(previousOrientation, currentOrientation, alpha) : currentOrientation;
+				calculateTransforms(position, orientation, parentEntity != nullptr ? &parentEntity->getRenderLocalToWorldTransform() : nullptr,
+					parentEntity != nullptr ? &parentEntity->getRenderWorldToLocalTransform() : nullptr, renderLocalToWorldTransform, renderWorldToLocalTransform);
+				renderTransformsInterpolated = true;
+				onRenderTransformsChanged();
+			}
+			else if (renderTransformsInterpolated)
+			{
+				renderTransformsInterpolated = false;
+				onRenderTransformsChanged();
+			}
+		}
+
+		void Entity::markTransformsDirty()
+		{
+			// The descendants of a dirty entity are already dirty, so the recursion stops there.
+			if (transformsNeedUpdate())
+			{
+				return;
+			}
+			if (transformStore != nullptr)
+			{
+				transformStore->dirty[transformIndex] = 1;
+			}
+			else
+			{
+				transformsDirty = true;
+			}
+			// Only the topmost entity that became dirty goes in the world's list, since the walk from it reaches the rest.
+			if (world != nullptr && transformStore == nullptr && (!parent.isValid() || !parent->transformsDirty))
+			{
+				world->onEntityTransformsDirty(this);
+			}
+			onTransformsDirty();
+			for (auto child : children)
+			{
+				child->markTransformsDirty();
+			}
+		}
+
+		World * Entity::getWorld() const
+		{
+			return world;
+		}
+
+		bool Entity::areRenderTransformsInterpolated() const
+		{
+			return renderTransformsInterpolated;
+		}
+
+		void Entity::onTransformsDirty()
+		{
+		}
+
+		void Entity::onRenderTransformsChanged()
+		{
+		}
+
+		void Entity::markMoving()
+		{
+			if (world != nullptr)
+			{
+				world->onEntityMoving(this);
+			}
+		}
+
+		void Entity::markHierarchyChanged()
+		{
+			// The render transforms depend on the parent's.
+			markMoving();
+			if (transformStore != nullptr)
+			{
+				transformStore->levelsNeedUpdate = true;
+			}
+			else if (transformsDirty && world != nullptr)
+			{
+				// It may no longer be under the entity whose walk would have updated it.
+				world->onEntityTransformsDirty(this);
+			}
+		}
+
+		void Entity::calculateTransforms(Vector3f const & position, Quaternionf const & orientation, Entity const * parent, Matrix44f & localToWorldTransform, Matrix44f & worldToLocalTransform)
+		{
+			if (parent != nullptr)
+			{
+				calculateTransforms(position, orientation, &parent->getLocalToWorldTransform(), &parent->getWorldToLocalTransform(), localToWorldTransform, worldToLocalTransform);
+			}
+			else
+			{
+				calculateTransforms(position, orientation, nullptr, nullptr, localToWorldTransform, worldToLocalTransform);
+			}
+		}
+
+		void Entity::calculateTransforms(Vector3f const & position, Quaternionf const & orientation, Matrix44f const * parentLocalToWorldTransform, Matrix44f const * parentWorldToLocalTransform, Matrix44f & localToWorldTransform, Matrix44f & worldToLocalTransform)
+		{
+			Matrix33f rot = orientation.getMatrix();
+			Matrix44f localToParentTransform = Matrix44f::identity();
+			Matrix44f parentToLocalTransform = Matrix44f::identity();
+			localToParentTransform(0, 0) = rot(0, 0);
+			localToParentTransform(1, 0) = rot(1, 0);
+			localToParentTransform(2, 0) = rot(2, 0);
+			localToParentTransform(0, 1) = rot(0, 1);
+			localToParentTransform(1, 1) = rot(1, 1);
+			localToParentTransform(2, 1) = rot(2, 1);
+			localToParentTransform(0, 2) = rot(0, 2);
+			localToParentTransform(1, 2) = rot(1, 2);
+			localToParentTransform(2, 2) = rot(2, 2);
+			localToParentTransform(0, 3) = position[0];
+			localToParentTransform(1, 3) = position[1];
+			localToParentTransform(2, 3) = position[2];
+			parentToLocalTransform(0, 0) = rot(0, 0);
+			parentToLocalTransform(1, 0) = rot(0, 1);
+			parentToLocalTransform(2, 0) = rot(0, 2);
+			parentToLocalTransform(0, 1) = rot(1, 0);
+			parentToLocalTransform(1, 1) = rot(1, 1);
+			parentToLocalTransform(2, 1) = rot(1, 2);
+			parentToLocalTransform(0, 2) = rot(2, 0);
+			parentToLocalTransform(1, 2) = rot(2, 1);
+			parentToLocalTransform(2, 2) = rot(2, 2);
+			parentToLocalTransform(0, 3) = (-position[0] * rot(0, 0) - position[1] * rot(1, 0) - position[2] * rot(2, 0));
+			parentToLocalTransform(1, 3) = (-position[0] * rot(0, 1) - position[1] * rot(1, 1) - position[2] * rot(2, 1));
+			parentToLocalTransform(2, 3) = (-position[0] * rot(0, 2) - position[1] * rot(1, 2) - position[2] * rot(2, 2));
+			if (parentLocalToWorldTransform != nullptr)
+			{
+				localToWorldTransform = *parentLocalToWorldTransform * localToParentTransform;
+				worldToLocalTransform = parentToLocalTransform * *parentWorldToLocalTransform;
+			}
+			else
+			{
+				localToWorldTransform = localToParentTransform;
+				worldToLocalTransform = parentToLocalTransform;
 			}
 		}
 	}
@@ -3,46 +3,117 @@
 #include "util/vector.hpp"
 #include "util/matrix.hpp"
 #include "util/quaternion.hpp"
+#include "util/ptr.hpp"
+#include <vector>
 
 namespace ve
 {
 	namespace world
 	{
+		class TransformStore;
+		class World;
+
 		class Entity
 		{
 		public:
-			// Constructs at the origin with the identity orientation.
+			// Constructs at the origin with the identity orientation and no parent.
 			Entity();
 
-			// Virtual destructor for inheritance.
+			// Virtual destructor for inheritance. Any children lose their parent.
 			virtual ~Entity();
 
-			// Returns the position.
+			// Returns the parent, or null if there is none.
+			Ptr<Entity> getParent() const;
+
+			// Sets the parent. The position and orientation become relative to the parent. The parent must be in the same world. Pass null to remove the parent.
+			void setParent(Ptr<Entity> const & parent);
+
+			// Returns the children. Internal to world.
+			std::vector<Entity *> const & getChildren() const;
+
+			// Returns the position relative to the parent.
 			Vector3f const & getPosition() const;
 
-			// Sets the position.
+			// Sets the position relative to the parent.
 			void setPosition(Vector3f const & position);
 
-			// Returns the orientation.
+			// Returns the orientation relative to the parent.
 			Quaternionf const & getOrientation() const;
 
-			// Sets the orientation.
+			// Sets the orientation relative to the parent.
 			void setOrientation(Quaternionf const & orientation);
 
-			// Returns the local to world transform matrix.
+			// Returns the position in world coordinates, as of the last transform update.
+			Vector3f getWorldPosition() const;
+
+			// Returns the local to world transform matrix, as of the last transform update.
 			Matrix44f const & getLocalToWorldTransform() const;
 
-			// Returns the world to local transform matrix.
+			// Returns the world to local transform matrix, as of the last transform update.
 			Matrix44f const & getWorldToLocalTransform() const;
 
+			// Returns the local to world transform matrix interpolated between the last two updates, as of the last render transform update. Rendering uses it so that motion is smooth between updates.
+			Matrix44f const & getRenderLocalToWorldTransform() const;
+
+			// Returns the world to local transform matrix interpolated between the last two updates, as of the last render transform update.
+			Matrix44f const & getRenderWorldToLocalTransform() const;
+
+			// Returns true if the world transforms are out of date.
+			bool transformsNeedUpdate() const;
+
+			// Updates the world transforms from the parent's world transforms, if needed. The parent must already be updated. Does nothing if the entity is in a transform store. Internal to world.
+			void updateTransforms();
+
+			// Keeps the position and orientation as those of the previous update. Called by the world at the start of each update if the entity moved since the last one. Internal to world.
+			void savePreviousTransforms();
+
+			// Updates the render transforms, alpha of the way from the previous update to the current one. The parent must already be updated. Internal to world.
+			void updateRenderTransforms(float alpha);
+
+		protected:
+			// The list index of an entity that isn't in one of the world's lists. Internal to world.
+			static unsigned int const notListed = (unsigned int)-1;
+
+			// Returns the world that created the entity, or null if there is none.
+			World * getWorld() const;
+
+			// Returns true if the render transforms are interpolated, rather than being the world transforms.
+			bool areRenderTransformsInterpolated() const;
+
+			// Called when the world transforms become out of date, because the entity or one of its ancestors moved.
+			virtual void onTransformsDirty();
+
+			// Called when the render transforms change, because the entity or one of its ancestors is between positions or has just stopped being so.
+			virtual void onRenderTransformsChanged();
+
 		private:
-			void checkTransforms() const;
+			void markTransformsDirty();
+			void markMoving();
+			void markHierarchyChanged();
+			static void calculateTransforms(Vector3f const & position, Quaternionf const & orientation, Entity const * parent, Matrix44f & localToWorldTransform, Matrix44f & worldToLocalTransform);
+			static void calculateTransforms(Vector3f const & position, Quaternionf const & orientation, Matrix44f const * parentLocalToWorldTransform, Matrix44f const * parentWorldToLocalTransform, Matrix44f & localToWorldTransform, Matrix44f & worldToLocalTransform);
 
+			World * world; // The world that created the entity, if any.
+			Ptr<Entity> parent;
+			std::vector<Entity *> children;
+			TransformStore * transformStore; // If not null, the transforms below are unused and the store's are used instead.
+			unsigned int transformIndex; // The index in the transform store.
 			Vector3f position;
 			Quaternionf orientation;
-			mutable bool transformsNeedUpdate;
-			mutable Matrix44f localToWorldTransform;
-			mutable Matrix44f worldToLocalTransform;
+			bool transformsDirty; // If true, so are the transforms of all descendants.
+			unsigned int dirtyRootsIndex; // The index of the entity in the world's list of dirty roots, or notListed.
+			unsigned int movingEntitiesIndex; // The index of the entity in the world's list of moving entities, or notListed.
+			Matrix44f localToWorldTransform;
+			Matrix44f worldToLocalTransform;
+			Vector3f previousPosition;
+			Quaternionf previousOrientation;
+			bool previousTransformsValid; // False until the first update, so that new entities don't move from the origin.
+			bool renderTransformsInterpolated; // If false, the render transforms are the world transforms.
+			Matrix44f renderLocalToWorldTransform;
+			Matrix44f renderWorldToLocalTransform;
+
+			friend class TransformStore;
+			friend class World;
 		};
 	}
 }
@@ -1,23 +1,24 @@
 #include "world/object.hpp"
+#include "world/world.hpp"
 #include <fstream>
 
 namespace ve
 {
 	namespace world
 	{
+		render::Shader::UniformId const localToWorldTransformUniformId = render::Shader::getUniformId("localToWorldTransform");
+
 		Object::Object(Ptr<render::Scene> const & scene_)
 		{
-			localToWorldTransformLocation = -1;
+			movedObjectsIndex = notListed;
+			boundsId = 0;
+			boundsValid = false;
 			scene = scene_;
 			model = scene->createModel();
 			model->setUniformsFunction([this](Ptr<render::Shader> const & shader)
 			{
-				if (localToWorldTransformLocation == -1)
-				{
-					localToWorldTransformLocation = shader->getUniformInfo("localToWorldTransform").location;
-				}
-				shader->setUniformValue(localToWorldTransformLocation, getLocalToWorldTransform());
-			});
+				shader->setUniformValue(localToWorldTransformUniformId, getRenderLocalToWorldTransform());
+			}, true);
 			mesh.setNew();
 			model->setMesh(mesh);
 			updateShader();
@@ -34,6 +35,10 @@ namespace ve
 
 		Object::~Object()
 		{
+			if (getWorld() != nullptr)
+			{
+				getWorld()->onObjectDestroyed(this);
+			}
 			scene->destroyModel(model);
 		}
 
@@ -42,6 +47,71 @@ namespace ve
 			return model;
 		}
 
+		bool Object::hasBounds() const
+		{
+			return boundsValid;
+		}
+
+		Boxf const & Object::getBounds() const
+		{
+			return bounds;
+		}
+
+		void Object::updateBounds()
+		{
+			// If the render transforms are interpolated, they are updated next, and then so is the model. Otherwise they are the world transforms, which have changed.
+			if (!areRenderTransformsInterpolated())
+			{
+				updateModelTransforms();
+			}
+			Ptr<render::Mesh> modelMesh = model->getMesh();
+			boundsValid = modelMesh.isValid() && modelMesh->hasBounds();
+			if (!boundsValid)
+			{
+				return;
+			}
+			// The box around the transformed mesh box has the transformed center and the extents of the absolute rotation.
+			Matrix44f const & transform = getLocalToWorldTransform();
+			Boxf const & meshBounds = modelMesh->getBounds();
+			Vector3f center = transform.transform((meshBounds.min + meshBounds.max) / 2.f, 1);
+			Vector3f extent = (meshBounds.max - meshBounds.min) / 2.f;
+			Vector3f worldExtent;
+			for (unsigned int i = 0; i < 3; i++)
+			{
+				worldExtent[i] = std::abs(transform(i, 0)) * extent[0] + std::abs(transform(i, 1)) * extent[1] + std::abs(transform(i, 2)) * extent[2];
+			}
+			bounds = Boxf(center - worldExtent, center + worldExtent);
+		}
+
+		void Object::onTransformsDirty()
+		{
+			if (movedObjectsIndex == notListed && getWorld() != nullptr)
+			{
+				getWorld()->onObjectMoved(this);
+			}
+		}
+
+		void Object::onRenderTransformsChanged()
+		{
+			updateModelTransforms();
+		}
+
+		void Object::updateModelTransforms()
+		{
+			Matrix44f const & transform = getRenderLocalToWorldTransform();
+			model->setInstanceTransform(transform);
+			Ptr<render::Mesh> modelMesh = model->getMesh();
+			if (modelMesh.isValid() && modelMesh->hasBounds())
+			{
+				Sphere3f const & sphere = modelMesh->getBoundingSphere();
+				model->setBoundingSphere(Sphere3f(transform.transform(sphere.center, 1), sphere.radius));
+			}
+			else
+			{
+				model->setBoundingSphere(Sphere3f(Vector3f {0, 0, 0}, -1));
+			}
+		}
+
 		void Object::updateShader()
 		{
 			//Ptr<render::Shader> shader = getStore()->shaders.get("object");
@@ -52,8 +122,7 @@ namespace ve
 			//		"#version 430\n"
 			//		"attribute vec3 position3d;\n"
 			//		"uniform mat4 localToWorldTransform;\n"
-			//		"uniform mat4 worldToCameraTramsform;\n"
-			//		"uniform mat4 cameraToNdcTransform;\n"
+			//		"layout(std140) uniform Camera { mat4 worldToCameraTramsform; mat4 cameraToNdcTransform; };\n"
 			//		"uniform float flipY;\n"
 			//		"void main(void)\n"
 			//		"{\n"
@@ -2,6 +2,7 @@
 
 #include "world/entity.hpp"
 #include "render/scene.hpp"
+#include "util/box.hpp"
 
 namespace ve
 {
@@ -22,13 +23,37 @@ namespace ve
 			// Returns the render model used by the object.
 			Ptr<render::Model> getModel() const;
 
+			// Returns true if the mesh has bounds.
+			bool hasBounds() const;
+
+			// Returns the axis-aligned box around the mesh in world coordinates, as of the last transform update.
+			Boxf const & getBounds() const;
+
+			// Updates the bounds from the mesh and the world transforms. Internal to world.
+			void updateBounds();
+
+		protected:
+			// Tells the world that the object moved.
+			void onTransformsDirty() override;
+
+			// Updates the instance transform and the bounding sphere of the model.
+			void onRenderTransformsChanged() override;
+
 		private:
+			// Sets the instance transform and the bounding sphere of the model from the render transforms, which it is drawn and culled with.
+			void updateModelTransforms();
+
 			void updateShader();
 
 			Ptr<render::Scene> scene;
 			Ptr<render::Model> model;
 			OwnPtr<render::Mesh> mesh;
-			int localToWorldTransformLocation;
+			unsigned int movedObjectsIndex; // The index of the object in the world's list of moved objects, or notListed.
+			unsigned int boundsId; // The id of the bounds in the world's bounding volume hierarchy.
+			bool boundsValid;
+			Boxf bounds;
+
+			friend class World;
 		};
 	}
 }
\ No newline at end of file
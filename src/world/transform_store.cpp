@@ -0,0 +1,157 @@
+#include "world/transform_store.hpp"
+#include <algorithm>
+
+namespace ve
+{
+	namespace world
+	{
+		TransformStore::TransformStore()
+		{
+			levelsNeedUpdate = false;
+		}
+
+		TransformStore::~TransformStore()
+		{
+			while (!entities.empty())
+			{
+				remove(entities.back());
+			}
+		}
+
+		void TransformStore::add(Entity * entity)
+		{
+			if (entity->transformStore == this)
+			{
+				return;
+			}
+			if (entity->transformStore != nullptr)
+			{
+				entity->transformStore->remove(entity);
+			}
+			entity->transformStore = this;
+			entity->transformIndex = (unsigned int)entities.size();
+			entities.push_back(entity);
+			positions.push_back(entity->position);
+			orientations.push_back(entity->orientation);
+			localToWorldTransforms.push_back(entity->localToWorldTransform);
+			worldToLocalTransforms.push_back(entity->worldToLocalTransform);
+			dirty.push_back(entity->transformsDirty ? 1 : 0);
+			levelsNeedUpdate = true;
+		}
+
+		void TransformStore::remove(Entity * entity)
+		{
+			if (entity->transformStore != this)
+			{
+				return;
+			}
+			unsigned int index = entity->transformIndex;
+			entity->position = positions[index];
+			entity->orientation = orientations[index];
+			entity->localToWorldTransform = localToWorldTransforms[index];
+			entity->worldToLocalTransform = worldToLocalTransforms[index];
+			entity->transformsDirty = dirty[index] != 0;
+			entity->transformStore = nullptr;
+
+			// Move the last entity into the hole.
+			unsigned int last = (unsigned int)entities.size() - 1;
+			if (index != last)
+			{
+				entities[index] = entities[last];
+				positions[index] = positions[last];
+				orientations[index] = orientations[last];
+				localToWorldTransforms[index] = localToWorldTransforms[last];
+				worldToLocalTransforms[index] = worldToLocalTransforms[last];
+				dirty[index] = dirty[last];
+				entities[index]->transformIndex = index;
+			}
+			entities.pop_back();
+			positions.pop_back();
+			orientations.pop_back();
+			localToWorldTransforms.pop_back();
+			worldToLocalTransforms.pop_back();
+			dirty.pop_back();
+			levelsNeedUpdate = true;
+		}
+
+		unsigned int TransformStore::size() const
+		{
+			return (unsigned int)entities.size();
+		}
+
+		void TransformStore::update(TaskScheduler & taskScheduler)
+		{
+			if (levelsNeedUpdate)
+			{
+				updateLevels();
+			}
+
+			// A dirty entity's descendants are dirty too, so each entity only needs its own flag. The parents were updated in the previous level.
+			unsigned int levelBegin = 0;
+			for (auto levelEnd : levelEnds)
+			{
+				taskScheduler.parallelFor(levelBegin, levelEnd, [this](unsigned int i)
+				{
+					unsigned int index = levelOrder[i];
+					if (dirty[index] != 0)
+					{
+						Entity::calculateTransforms(positions[index], orientations[index], entities[index]->parent.raw(), localToWorldTransforms[index], worldToLocalTransforms[index]);
+					}
+				}, 256);
+				levelBegin = levelEnd;
+			}
+			std::fill(dirty.begin(), dirty.end(), (uint8_t)0);
+		}
+
+		void TransformStore::updateRenderTransforms(float alpha, TaskScheduler & taskScheduler)
+		{
+			if (levelsNeedUpdate)
+			{
+				updateLevels();
+			}
+			unsigned int levelBegin = 0;
+			for (auto levelEnd : levelEnds)
+			{
+				taskScheduler.parallelFor(levelBegin, levelEnd, [this, alpha](unsigned int i)
+				{
+					entities[levelOrder[i]]->updateRenderTransforms(alpha);
+				}, 256);
+				levelBegin = levelEnd;
+			}
+		}
+
+		void TransformStore::updateLevels()
+		{
+			// The roots are the entities whose parents are not in the store. Each following level is the children of the previous one.
+			levelOrder.clear();
+			levelEnds.clear();
+			for (unsigned int index = 0; index < entities.size(); index++)
+			{
+				Entity * parent = entities[index]->parent.raw();
+				if (parent == nullptr || parent->transformStore != this)
+				{
+					levelOrder.push_back(index);
+				}
+			}
+			unsigned int levelBegin = 0;
+			while (levelBegin < levelOrder.size())
+			{
+				unsigned int levelEnd = (unsigned int)levelOrder.size();
+				levelEnds.push_back(levelEnd);
+				for (unsigned int i = levelBegin; i < levelEnd; i++)
+				{
+					for (auto child : entities[levelOrder[i]]->children)
+					{
+						if (child->transformStore == this)
+						{
+							levelOrder.push_back(child->transformIndex);
+						}
+					}
+				}
+				levelBegin = levelEnd;
+			}
+			levelsNeedUpdate = false;
+		}
+	}
+}
+
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "world/entity.hpp"
+#include "util/task_scheduler.hpp"
+#include <vector>
+#include <cstdint>
+
+namespace ve
+{
+	namespace world
+	{
+		// Holds the positions, orientations, and world transforms of many entities in contiguous arrays, so that they can be updated together in parallel.
+		// An entity in a store reads and writes its transforms here instead of in itself.
+		class TransformStore
+		{
+		public:
+			// Constructs an empty store.
+			TransformStore();
+
+			// Moves the transforms of any remaining entities back into them.
+			~TransformStore();
+
+			// Moves the transforms of the entity into the store. Does nothing if it is already in the store.
+			void add(Entity * entity);
+
+			// Moves the transforms of the entity back into it. Does nothing if it is not in the store.
+			void remove(Entity * entity);
+
+			// Returns the number of entities.
+			unsigned int size() const;
+
+			// Updates the world transforms of every entity whose transforms are out of date. Each level of the hierarchy is split across the threads of the scheduler.
+			void update(TaskScheduler & taskScheduler);
+
+			// Updates the render transforms of every entity, alpha of the way from the previous update. Each level of the hierarchy is split across the threads of the scheduler.
+			void updateRenderTransforms(float alpha, TaskScheduler & taskScheduler);
+
+		private:
+			void updateLevels();
+
+			std::vector<Entity *> entities;
+			std::vector<Vector3f> positions;
+			std::vector<Quaternionf> orientations;
+			std::vector<Matrix44f> localToWorldTransforms;
+			std::vector<Matrix44f> worldToLocalTransforms;
+			std::vector<uint8_t> dirty; // Not a vector<bool>, so that different threads can write different elements.
+			std::vector<unsigned int> levelOrder; // The indices ordered by depth in the hierarchy, parents first.
+			std::vector<unsigned int> levelEnds; // The end of each level in levelOrder.
+			bool levelsNeedUpdate;
+
+			friend class Entity;
+		};
+	}
+}
+
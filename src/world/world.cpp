@@ -1,38 +1,52 @@
 #include "world/world.hpp"
+#include "util/intersection.hpp"
+#include "util/profiler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <string>
 
 namespace ve
 {
 	namespace world
 	{
+		// The std140 layout of the uniform block
+		//   layout(std140) uniform Lights { vec4 lightPositions[16]; vec4 lightColors[16]; int numLights; };
+		struct LightsUniforms
+		{
+			Vector4f positions[World::maxLights];
+			Vector4f colors[World::maxLights];
+			int numLights;
+			int pad[3]; // std140 rounds the size of the block up to a multiple of 16 bytes.
+		};
+		static_assert(sizeof(LightsUniforms) == 528, "LightsUniforms is not the std140 size of the Lights block.");
+
 		World::World()
 		{
 			scene.setNew();
-			scene->setUniformsFunction([this](Ptr<render::Shader> const & shader)
-			{
-				unsigned int lightIndex = 0;
-				for (auto && light : lights)
-				{
-					shader->setUniformValue(("light" + std::to_string(lightIndex) + "Position").c_str(), light->getPosition());
-					shader->setUniformValue(("light" + std::to_string(lightIndex) + "Color").c_str(), light->getColor());
-					lightIndex++;
-				}
-			});
+			lightsUniformBuffer.setNew("Lights");
+			scene->setUniformBuffer(lightsUniformBuffer);
 		}
 
 		World::~World()
 		{
+			// The entities tell the world when they are destroyed, so destroy them while it is whole.
 			objects.queueAllForErase();
 			objects.processEraseQueue();
+			lights.queueAllForErase();
+			lights.processEraseQueue();
+			cameras.queueAllForErase();
+			cameras.processEraseQueue();
 			scene.setNull();
 		}
 
 		void World::setupTarget(Ptr<render::Target> const & target, Ptr<Camera> const & camera)
 		{
 			target->setScene(scene);
-			target->setUniformsFunction([camera](Ptr<render::Shader> const & shader)
+			target->setUniformBuffer(camera->getUniformBuffer());
+			target->setFrustumFunction([camera]()
 			{
-				shader->setUniformValue("worldToCameraTramsform", camera->getWorldToLocalTransform());
-				shader->setUniformValue("cameraToNdcTransform", camera->getLocalToNdcTransform());
+				return Frustum(camera->getLocalToNdcTransform() * camera->getRenderWorldToLocalTransform());
 			});
 		}
 
@@ -62,15 +76,372 @@ namespace ve
 		}
 
 		void World::update(float dt)
+		{
+			// Keep where the moving entities were before this update, so that rendering can interpolate from there. The others are still where they were kept.
+			for (auto entity : movingEntities)
+			{
+				entity->savePreviousTransforms();
+			}
+
+			// Group the controllers that are due by their divisors, so that each group can be timed.
+			for (auto && controller : controllers)
+			{
+				UpdateSchedule & schedule = controller->getUpdateSchedule();
+				if (!schedule.advance(numUpdates, dt, nextControllerPhases))
+				{
+					continue;
+				}
+				unsigned int divisor = schedule.getCurrentDivisor();
+				auto group = std::lower_bound(controllerGroups.begin(), controllerGroups.end(), divisor, [](ControllerGroup const & group, unsigned int divisor)
+				{
+					return group.divisor < divisor;
+				});
+				if (group == controllerGroups.end() || group->divisor != divisor)
+				{
+					group = controllerGroups.insert(group, ControllerGroup {divisor, {}});
+				}
+				group->controllers.push_back(controller.raw());
+			}
+			bool profiling = Profiler::isInitialized();
+			for (auto && group : controllerGroups)
+			{
+				if (group.controllers.empty())
+				{
+					continue;
+				}
+				auto startTime = std::chrono::steady_clock::now();
+				for (auto controller : group.controllers)
+				{
+					controller->update(dt * group.divisor);
+				}
+				if (profiling)
+				{
+					float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
+					Profiler::addSample("controllers updating every " + std::to_string(group.divisor) + " world updates (" + std::to_string(group.controllers.size()) + ")", seconds);
+				}
+				group.controllers.clear();
+			}
+			numUpdates++;
+		}
+
+		UpdateSchedule & World::getUpdateSchedule()
+		{
+			return updateSchedule;
+		}
+
+		bool World::isUpdateConcurrent() const
+		{
+			return updateConcurrent;
+		}
+
+		void World::setUpdateConcurrent(bool concurrent)
+		{
+			updateConcurrent = concurrent;
+		}
+
+		void World::processEraseQueues()
 		{
 			cameras.processEraseQueue();
 			lights.processEraseQueue();
 			objects.processEraseQueue();
 			controllers.processEraseQueue();
+		}
 
-			for (auto && controller : controllers)
+		void World::updateUniformBuffers()
+		{
+			for (auto && camera : cameras)
+			{
+				camera->updateUniformBuffer();
+			}
+			LightsUniforms uniforms;
+			uniforms.numLights = 0;
+			for (auto && light : lights)
+			{
+				if ((unsigned int)uniforms.numLights == maxLights)
+				{
+					break;
+				}
+				Matrix44f const & transform = light->getRenderLocalToWorldTransform();
+				Vector3f position = {transform(0, 3), transform(1, 3), transform(2, 3)};
+				Vector3f color = light->getColor();
+				uniforms.positions[uniforms.numLights] = {position[0], position[1], position[2], 1};
+				uniforms.colors[uniforms.numLights] = {color[0], color[1], color[2], 1};
+				uniforms.numLights++;
+			}
+			lightsUniformBuffer->setData(uniforms);
+		}
+
+		bool World::isTransformStoreEnabled() const
+		{
+			return transformStore.isValid();
+		}
+
+		void World::setTransformStoreEnabled(bool enabled)
+		{
+			if (enabled && !transformStore.isValid())
+			{
+				transformStore.setNew();
+				addToTransformStore(cameras);
+				addToTransformStore(lights);
+				addToTransformStore(objects);
+				for (auto entity : dirtyRoots)
+				{
+					entity->dirtyRootsIndex = Entity::notListed;
+				}
+				dirtyRoots.clear(); // The store keeps its own dirty flags.
+			}
+			else if (!enabled && transformStore.isValid())
+			{
+				transformStore.setNull(); // Moves the transforms back into the entities.
+				addToDirtyRoots(cameras);
+				addToDirtyRoots(lights);
+				addToDirtyRoots(objects);
+			}
+		}
+
+		void World::updateTransforms(TaskScheduler & taskScheduler)
+		{
+			if (transformStore.isValid())
+			{
+				transformStore->update(taskScheduler);
+			}
+			else
+			{
+				// Walk the subtrees of the dirty roots, parents before children. An ancestor may have become dirty after a root, so each walk starts at the topmost dirty ancestor.
+				for (auto root : dirtyRoots)
+				{
+					root->dirtyRootsIndex = Entity::notListed;
+					while (root->parent.isValid() && root->parent->transformsDirty)
+					{
+						root = root->parent.raw();
+					}
+					if (!root->transformsDirty)
+					{
+						continue; // Already walked from another root.
+					}
+					fillTransformQueue(root);
+					for (auto entity : transformQueue)
+					{
+						entity->updateTransforms();
+					}
+				}
+				dirtyRoots.clear();
+			}
+
+			// Only the objects that moved need their bounds updated.
+			for (auto object : movedObjects)
+			{
+				object->movedObjectsIndex = Entity::notListed;
+				bool wasInBvh = object->boundsValid;
+				object->updateBounds();
+				if (object->boundsValid && wasInBvh)
+				{
+					objectBvh.move(object->boundsId, object->bounds);
+				}
+				else if (object->boundsValid)
+				{
+					object->boundsId = objectBvh.insert(object->bounds, objects.get(objects.getHandle(object)));
+				}
+				else if (wasInBvh)
+				{
+					objectBvh.remove(object->boundsId);
+				}
+			}
+			movedObjects.clear();
+		}
+
+		void World::updateRenderTransforms(float alpha, TaskScheduler & taskScheduler)
+		{
+			if (transformStore.isValid())
+			{
+				transformStore->updateRenderTransforms(alpha, taskScheduler);
+			}
+			else
+			{
+				// The interpolated entities are all below moving ones, so walk the subtrees of the moving entities that have no moving ancestor.
+				movingRoots.clear();
+				for (auto entity : movingEntities)
+				{
+					Entity * ancestor = entity->parent.raw();
+					while (ancestor != nullptr && ancestor->movingEntitiesIndex == Entity::notListed)
+					{
+						ancestor = ancestor->parent.raw();
+					}
+					if (ancestor == nullptr)
+					{
+						movingRoots.push_back(entity);
+					}
+				}
+				for (auto root : movingRoots)
+				{
+					fillTransformQueue(root);
+					for (auto entity : transformQueue)
+					{
+						entity->updateRenderTransforms(alpha);
+					}
+				}
+			}
+
+			// Keep the entities that are interpolated, so that they are walked again when they stop, and those whose previous transforms are yet to be kept.
+			unsigned int numKept = 0;
+			for (auto entity : movingEntities)
+			{
+				if (entity->renderTransformsInterpolated || !entity->previousTransformsValid)
+				{
+					entity->movingEntitiesIndex = numKept;
+					movingEntities[numKept] = entity;
+					numKept++;
+				}
+				else
+				{
+					entity->movingEntitiesIndex = Entity::notListed;
+				}
+			}
+			movingEntities.resize(numKept);
+		}
+
+		void World::findObjects(Boxf const & box, std::vector<Ptr<Object>> & results) const
+		{
+			objectBvh.findOverlapping(box, results);
+		}
+
+		void World::findObjects(Sphere3f const & sphere, std::vector<Ptr<Object>> & results) const
+		{
+			objectBvh.findOverlapping(sphere, results);
+		}
+
+		void World::findObjects(Frustum const & frustum, std::vector<Ptr<Object>> & results) const
+		{
+			objectBvh.findOverlapping(frustum, results);
+		}
+
+		World::PickResult World::pick(Ray3f const & ray) const
+		{
+			PickResult result;
+			result.fraction = std::numeric_limits<float>::infinity();
+			result.triangle = 0;
+			objectBvh.traverse([&ray, &result](Boxf const & box)
+			{
+				return intersection::rayBox(ray, box, result.fraction) >= 0;
+			}, [this, &ray, &result](Ptr<Object> const & object, Boxf const &)
+			{
+				pickTriangles(object, ray, result);
+			});
+			return result;
+		}
+
+		void World::pick(Ray3f const * rays, PickResult * results, unsigned int count) const
+		{
+			// The rays go down the tree in packets of four, so that each node is loaded once for all of them.
+			for (unsigned int i = 0; i < count; i += 4)
+			{
+				unsigned int packetCount = (count - i < 4) ? count - i : 4;
+				intersection::RayPacket packet(rays + i, packetCount);
+				float fractions[4];
+				for (unsigned int j = 0; j < 4; j++)
+				{
+					fractions[j] = std::numeric_limits<float>::infinity();
+					if (j < packetCount)
+					{
+						results[i + j].object.setNull();
+						results[i + j].fraction = fractions[j];
+						results[i + j].triangle = 0;
+					}
+				}
+				objectBvh.traverse([&packet, &fractions](Boxf const & box)
+				{
+					return intersection::rayPacketBox(packet, fractions, box) != 0;
+				}, [&](Ptr<Object> const & object, Boxf const & box)
+				{
+					unsigned int mask = intersection::rayPacketBox(packet, fractions, box);
+					for (unsigned int j = 0; j < packetCount; j++)
+					{
+						if ((mask & (1 << j)) && pickTriangles(object, rays[i + j], results[i + j]))
+						{
+							fractions[j] = results[i + j].fraction;
+						}
+					}
+				});
+			}
+		}
+
+		void World::fillTransformQueue(Entity * root)
+		{
+			// Breadth-first, so that each parent is before its children.
+			transformQueue.clear();
+			transformQueue.push_back(root);
+			for (size_t i = 0; i < transformQueue.size(); i++)
+			{
+				for (auto child : transformQueue[i]->getChildren())
+				{
+					transformQueue.push_back(child);
+				}
+			}
+		}
+
+		bool World::pickTriangles(Ptr<Object> const & object, Ray3f const & ray, PickResult & result) const
+		{
+			Ptr<render::Mesh> mesh = object->getModel()->getMesh();
+			if (!mesh.isValid() || mesh->getNumIndicesPerPrimitive() != 3 || mesh->getPositions().empty() || mesh->getIndices().size() < 3)
+			{
+				return false;
+			}
+			// Test in the mesh's coordinates. The transform keeps fractions along the ray the same.
+			Matrix44f const & worldToLocalTransform = object->getWorldToLocalTransform();
+			Ray3f localRay(worldToLocalTransform.transform(ray.start, 1), worldToLocalTransform.transform(ray.offset, 0));
+			if (!intersection::rayTriangles(localRay, &mesh->getPositions()[0], &mesh->getIndices()[0], (unsigned int)mesh->getIndices().size() / 3, result.fraction, result.triangle))
+			{
+				return false;
+			}
+			result.object = object;
+			return true;
+		}
+
+		void World::onEntityTransformsDirty(Entity * entity)
+		{
+			if (entity->dirtyRootsIndex == Entity::notListed)
+			{
+				entity->dirtyRootsIndex = (unsigned int)dirtyRoots.size();
+				dirtyRoots.push_back(entity);
+			}
+		}
+
+		void World::onEntityMoving(Entity * entity)
+		{
+			if (entity->movingEntitiesIndex == Entity::notListed)
+			{
+				entity->movingEntitiesIndex = (unsigned int)movingEntities.size();
+				movingEntities.push_back(entity);
+			}
+		}
+
+		void World::onEntityDestroyed(Entity * entity)
+		{
+			if (entity->dirtyRootsIndex != Entity::notListed)
+			{
+				removeFromList(dirtyRoots, &Entity::dirtyRootsIndex, entity);
+			}
+			if (entity->movingEntitiesIndex != Entity::notListed)
+			{
+				removeFromList(movingEntities, &Entity::movingEntitiesIndex, entity);
+			}
+		}
+
+		void World::onObjectMoved(Object * object)
+		{
+			object->movedObjectsIndex = (unsigned int)movedObjects.size();
+			movedObjects.push_back(object);
+		}
+
+		void World::onObjectDestroyed(Object * object)
+		{
+			if (object->movedObjectsIndex != Entity::notListed)
+			{
+				removeFromList(movedObjects, &Object::movedObjectsIndex, object);
+			}
+			if (object->boundsValid)
 			{
-				controller->update(dt);
+				objectBvh.remove(object->boundsId);
 			}
 		}
 
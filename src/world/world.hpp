@@ -4,9 +4,11 @@
 #include "world/light.hpp"
 #include "world/object.hpp"
 #include "world/controller.hpp"
+#include "world/transform_store.hpp"
 #include "render/scene.hpp"
 #include "render/target.hpp"
 #include "util/ptr_set.hpp"
+#include "util/bvh.hpp"
 
 namespace ve
 {
@@ -15,6 +17,17 @@ namespace ve
 		class World
 		{
 		public:
+			// The most lights given to the shaders in the Lights uniform block. Any more are left out.
+			static unsigned int const maxLights = 16;
+
+			// The result of a pick.
+			struct PickResult
+			{
+				Ptr<Object> object; // The object hit, or null if none was.
+				float fraction; // The fraction along the ray's offset of the hit.
+				unsigned int triangle; // The index of the triangle hit in the object's mesh.
+			};
+
 			// Constructs an empty world. Fill it with things!
 			World();
 
@@ -45,37 +58,158 @@ namespace ve
 
 			void destroyController(Ptr<Controller> const & controller);
 
+			// Keeps the transforms of the entities that moved as those before the update, and then updates the controllers that are due. Called by App on the GL thread, or on a worker thread if the update is concurrent.
+			// The controllers update in groups by their update divisors, fastest first, and each gets the time since its last update.
 			void update(float dt);
 
+			// Returns true if App updates the world on a worker thread, concurrently with other worlds and with the gui updates. False by default.
+			bool isUpdateConcurrent() const;
+
+			// Sets whether App updates the world on a worker thread. When pipelined, such a world also handles its input events before the last frame is replayed.
+			// Only set it if no controller uses GL in its updates or input handling, including by creating objects or cameras, whose meshes and uniform buffers use it.
+			void setUpdateConcurrent(bool concurrent);
+
+			// Returns the schedule of the world's updates. By default it updates on every App update.
+			// Set a divisor or a rate for worlds that need fewer updates, such as a distant simulation. App spreads those with the same divisor across its updates.
+			UpdateSchedule & getUpdateSchedule();
+
+			// Destroys the cameras, lights, objects, and controllers queued for destruction. Called by App on the GL thread before update.
+			void processEraseQueues();
+
+			// Updates the uniform buffers of the cameras and the lights, so that every shader rendering the world reads the same data. Called by App on the GL thread after updateRenderTransforms.
+			void updateUniformBuffers();
+
+			// Returns true if the cameras, lights, and objects keep their transforms in a transform store.
+			bool isTransformStoreEnabled() const;
+
+			// Sets whether the cameras, lights, and objects keep their transforms in a transform store, which updates them in parallel. It is worth it for many entities.
+			void setTransformStoreEnabled(bool enabled);
+
+			// Updates the world transforms of every entity whose transforms are out of date, parents before children, and then the bounds of the moved objects. Called by App after the updates and before rendering.
+			// Without a transform store, only the subtrees of the entities that moved are walked.
+			void updateTransforms(TaskScheduler & taskScheduler);
+
+			// Updates the render transforms of the entities, alpha of the way from their transforms before the last update to their current ones, so that rendering is smooth when there are fewer updates than frames.
+			// Without a transform store, only the subtrees of the entities that are moving or were interpolated are walked.
+			// Called by App after updateTransforms, with alpha as the time since the last update over the seconds per update.
+			void updateRenderTransforms(float alpha, TaskScheduler & taskScheduler);
+
+			// Appends the objects whose bounds overlap the box to results, as of the last transform update. Objects whose meshes have no bounds are never found.
+			void findObjects(Boxf const & box, std::vector<Ptr<Object>> & results) const;
+
+			// Appends the objects whose bounds overlap the sphere to results, as of the last transform update.
+			void findObjects(Sphere3f const & sphere, std::vector<Ptr<Object>> & results) const;
+
+			// Appends the objects whose bounds overlap the frustum to results, as of the last transform update.
+			void findObjects(Frustum const & frustum, std::vector<Ptr<Object>> & results) const;
+
+			// Returns the closest object hit by the ray, as of the last transform update. Only the triangles of the meshes are hit.
+			PickResult pick(Ray3f const & ray) const;
+
+			// Sets results[i] to the closest object hit by rays[i], for count rays. Neighboring rays that go the same way, like those from a camera, are faster together.
+			void pick(Ray3f const * rays, PickResult * results, unsigned int count) const;
+
 			void handleInputEvent(InputEvent const & inputEvent);
 
+			// Internal to world. Called by an entity when its transforms become out of date and its parent's are not, so that its subtree is updated.
+			void onEntityTransformsDirty(Entity * entity);
+
+			// Internal to world. Called by an entity when it is created, moved or reparented, so that its previous transforms are kept and its render transforms are updated.
+			void onEntityMoving(Entity * entity);
+
+			// Internal to world. Called by an entity when it is destroyed.
+			void onEntityDestroyed(Entity * entity);
+
+			// Internal to world. Called by an object when it moves, so that its bounds are updated.
+			void onObjectMoved(Object * object);
+
+			// Internal to world. Called by an object when it is destroyed.
+			void onObjectDestroyed(Object * object);
+
 		private:
+			// The controllers with a divisor that are due in an update.
+			struct ControllerGroup
+			{
+				unsigned int divisor;
+				std::vector<Controller *> controllers;
+			};
+
+			template <typename EntityType>
+			void addToTransformStore(PtrSet<EntityType> const & entities);
+
+			template <typename EntityType>
+			void addToDirtyRoots(PtrSet<EntityType> const & entities);
+
+			// Removes the item from the list by moving the last item into its place. Index is the member that holds each item's index in the list.
+			template <typename T>
+			static void removeFromList(std::vector<T *> & list, unsigned int T::* index, T * item);
+
+			// Fills the transform queue with the entity and its descendants, each parent before its children.
+			void fillTransformQueue(Entity * root);
+
+			bool pickTriangles(Ptr<Object> const & object, Ray3f const & ray, PickResult & result) const;
+
 			OwnPtr<render::Scene> scene;
+			OwnPtr<render::UniformBuffer> lightsUniformBuffer;
+			OwnPtr<TransformStore> transformStore; // Declared before the entities so that it outlives them.
+			std::vector<Entity *> dirtyRoots; // The entities whose transforms became out of date while their parents' were not. Declared before the entities so that it outlives them.
+			std::vector<Entity *> movingEntities; // The entities that moved since their previous transforms were kept, or whose render transforms are interpolated. Declared before the entities too.
 			PtrSet<Camera> cameras;
 			PtrSet<Light> lights;
 			PtrSet<Object> objects;
 			PtrSet<Controller> controllers;
+			std::vector<Entity *> transformQueue; // Kept between calls to save allocations.
+			std::vector<Entity *> movingRoots; // The moving entities without moving ancestors. Kept between calls to save allocations.
+			Bvh<Ptr<Object>> objectBvh;
+			std::vector<Object *> movedObjects; // The objects whose bounds are out of date.
+			UpdateSchedule updateSchedule;
+			unsigned int numUpdates = 0;
+			bool updateConcurrent = false;
+			std::map<unsigned int, unsigned int> nextControllerPhases; // The phase the next controller with a divisor gets, so that they take turns.
+			std::vector<ControllerGroup> controllerGroups; // Sorted by divisor. Kept between updates to save allocations.
 		};
 
 		template <typename CameraType>
 		Ptr<CameraType> World::createCamera()
 		{
 			static_assert(std::is_base_of<Camera, CameraType>::value, "Class is not derived from Camera. ");
-			return cameras.insertNew<CameraType>();
+			Ptr<CameraType> camera = cameras.insertNew<CameraType>();
+			if (transformStore.isValid())
+			{
+				transformStore->add(camera.raw());
+			}
+			camera->world = this;
+			onEntityMoving(camera.raw());
+			return camera;
 		}
 
 		template <typename LightType>
 		Ptr<LightType> World::createLight()
 		{
 			static_assert(std::is_base_of<Light, LightType>::value, "Class is not derived from Light. ");
-			return lights.insertNew<LightType>();
+			Ptr<LightType> light = lights.insertNew<LightType>();
+			if (transformStore.isValid())
+			{
+				transformStore->add(light.raw());
+			}
+			light->world = this;
+			onEntityMoving(light.raw());
+			return light;
 		}
 
 		template <typename ObjectType>
 		Ptr<ObjectType> World::createObject()
 		{
 			static_assert(std::is_base_of<Object, ObjectType>::value, "Class is not derived from Object. ");
-			return objects.insertNew<ObjectType>(scene);
+			Ptr<ObjectType> object = objects.insertNew<ObjectType>(scene);
+			if (transformStore.isValid())
+			{
+				transformStore->add(object.raw());
+			}
+			object->world = this;
+			onEntityMoving(object.raw());
+			onObjectMoved(object.raw());
+			return object;
 		}
 
 		template <typename ControllerType>
@@ -84,5 +218,36 @@ namespace ve
 			static_assert(std::is_base_of<Controller, ControllerType>::value, "Class is not derived from Controller. ");
 			return controllers.insertNew<ControllerType>();
 		}
+
+		template <typename EntityType>
+		void World::addToTransformStore(PtrSet<EntityType> const & entities)
+		{
+			for (auto && entity : entities)
+			{
+				transformStore->add(entity.raw());
+			}
+		}
+
+		template <typename T>
+		void World::removeFromList(std::vector<T *> & list, unsigned int T::* index, T * item)
+		{
+			T * last = list.back();
+			list[item->*index] = last;
+			last->*index = item->*index;
+			item->*index = Entity::notListed;
+			list.pop_back();
+		}
+
+		template <typename EntityType>
+		void World::addToDirtyRoots(PtrSet<EntityType> const & entities)
+		{
+			for (auto && entity : entities)
+			{
+				if (entity->transformsDirty)
+				{
+					onEntityTransformsDirty(entity.raw());
+				}
+			}
+		}
 	}
 }
\ No newline at end of file